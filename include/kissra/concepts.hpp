@@ -1,6 +1,7 @@
 #pragma once
 #include "kissra/impl/export.hpp"
 #include "kissra/misc/functional.hpp"
+#include "kissra/misc/optional.hpp"
 #include "kissra/misc/type_list.hpp"
 #include "kissra/ranges_traits.hpp"
 #include "kissra/type_traits.hpp"
@@ -52,6 +53,17 @@ concept bidir_iterator = forward_iterator<T> && is_bidir_v<T> && is_common_v<T>
 template <typename T>
 concept random_iterator = bidir_iterator<T> && is_random_v<T>;
 
+/**
+ * Iterator which can be cut into two independent iterators over consecutive disjoint parts of its items (both of the
+ * iterator's own type): `split_at(n)` - the first `n` items and the rest, `try_split()` - roughly the halves of the
+ * remaining work, empty if there is nothing to split. See `split_at_mixin`.
+ */
+template <typename T>
+concept splittable_iterator = forward_iterator<T> && std::copy_constructible<T> && requires(T t) {
+    { t.split_at(0uz) } -> std::same_as<std::pair<T, T>>;
+    { t.try_split() } -> std::same_as<kissra::optional<std::pair<T, T>>>;
+};
+
 
 template <typename T>
 concept composition_root = requires { typename T::is_composition_root; };
@@ -75,6 +87,9 @@ concept bidir_iterator = impl::bidir_iterator<std::remove_reference_t<T>>;
 template <typename T>
 concept random_iterator = impl::random_iterator<std::remove_reference_t<T>>;
 
+template <typename T>
+concept splittable_iterator = impl::splittable_iterator<std::remove_cvref_t<T>>;
+
 /* Type `T` can be used as source sequence for kissra iterators (either range or kissra iterator itself). */
 template <typename T>
 concept iterator_compatible = std::ranges::range<T> && std::is_lvalue_reference_v<T> || kissra::iterator<T>;
@@ -104,6 +119,15 @@ concept can_insert = std::ranges::range<T> && requires(T rng, TValue val) { rng.
 template <typename T>
 concept can_reserve = std::ranges::range<T> && requires(T rng) { rng.reserve(1); };
 
+/* Contiguous range of characters (`std::string`, `std::string_view`, `std::vector<char>`, ...). */
+template <typename TRng>
+concept char_range = std::ranges::contiguous_range<TRng> && std::ranges::sized_range<TRng> &&
+    std::same_as<std::remove_cv_t<std::ranges::range_value_t<TRng>>, char>;
+
+/* Kissra iterator over contiguous characters. */
+template <typename T>
+concept char_iterator = kissra::iterator<T> && is_contiguous_v<T> && std::same_as<std::remove_cv_t<iter_value_t<T>>, char>;
+
 template <typename T>
 concept tuple_like = requires { std::tuple_size<std::remove_cvref_t<T>>::value; };
 
@@ -0,0 +1,169 @@
+#pragma once
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/functional.hpp"
+
+#ifndef KISSRA_MODULE
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+/**
+ * Aggregates of `group_by(key_proj).aggregate(...)`: `init(item)` makes the state out of the first item of a group,
+ * `update(state, item)` folds every subsequent one in, `result(state)` is what ends up in the output. States live
+ * inline within the group table. Calling an aggregate with a projection aggregates projected items instead (e.g.
+ * `agg::sum(fn::member<1>)`).
+ */
+namespace functor {
+template <typename TProj = std::identity>
+struct agg_count_t {
+    template <typename T>
+    constexpr std::size_t init(T&&) const {
+        return 1;
+    }
+
+    template <typename T>
+    constexpr void update(std::size_t& state, T&&) const {
+        ++state;
+    }
+
+    constexpr std::size_t result(std::size_t state) const {
+        return state;
+    }
+
+    /* Every item counts regardless of the projection, accepted for uniformity with the other aggregates. */
+    template <typename TProjOther>
+    constexpr agg_count_t<TProjOther> operator()(TProjOther proj) const {
+        return { proj };
+    }
+
+    [[no_unique_address]] TProj proj;
+};
+
+template <typename TProj = std::identity>
+struct agg_sum_t {
+    template <typename T>
+    constexpr auto init(T&& item) const {
+        using value_t = std::remove_cvref_t<decltype(kissra::invoke(proj, std::forward<T>(item)))>;
+        using sum_t = std::remove_cvref_t<decltype(std::declval<value_t>() + std::declval<value_t>())>;
+        return static_cast<sum_t>(kissra::invoke(proj, std::forward<T>(item)));
+    }
+
+    template <typename TState, typename T>
+    constexpr void update(TState& state, T&& item) const {
+        state += kissra::invoke(proj, std::forward<T>(item));
+    }
+
+    template <typename TState>
+    constexpr TState result(TState state) const {
+        return state;
+    }
+
+    template <typename TProjOther>
+    constexpr agg_sum_t<TProjOther> operator()(TProjOther proj) const {
+        return { proj };
+    }
+
+    [[no_unique_address]] TProj proj;
+};
+
+template <typename TProj = std::identity>
+struct agg_min_t {
+    template <typename T>
+    constexpr auto init(T&& item) const {
+        return std::remove_cvref_t<decltype(kissra::invoke(proj, std::forward<T>(item)))>(
+            kissra::invoke(proj, std::forward<T>(item)));
+    }
+
+    template <typename TState, typename T>
+    constexpr void update(TState& state, T&& item) const {
+        decltype(auto) value = kissra::invoke(proj, std::forward<T>(item));
+        if (value < state) {
+            state = std::forward<decltype(value)>(value);
+        }
+    }
+
+    template <typename TState>
+    constexpr TState result(TState state) const {
+        return state;
+    }
+
+    template <typename TProjOther>
+    constexpr agg_min_t<TProjOther> operator()(TProjOther proj) const {
+        return { proj };
+    }
+
+    [[no_unique_address]] TProj proj;
+};
+
+template <typename TProj = std::identity>
+struct agg_max_t {
+    template <typename T>
+    constexpr auto init(T&& item) const {
+        return std::remove_cvref_t<decltype(kissra::invoke(proj, std::forward<T>(item)))>(
+            kissra::invoke(proj, std::forward<T>(item)));
+    }
+
+    template <typename TState, typename T>
+    constexpr void update(TState& state, T&& item) const {
+        decltype(auto) value = kissra::invoke(proj, std::forward<T>(item));
+        if (state < value) {
+            state = std::forward<decltype(value)>(value);
+        }
+    }
+
+    template <typename TState>
+    constexpr TState result(TState state) const {
+        return state;
+    }
+
+    template <typename TProjOther>
+    constexpr agg_max_t<TProjOther> operator()(TProjOther proj) const {
+        return { proj };
+    }
+
+    [[no_unique_address]] TProj proj;
+};
+
+template <typename TProj = std::identity>
+struct agg_mean_t {
+    struct state_t {
+        double sum;
+        std::size_t count;
+    };
+
+    template <typename T>
+    constexpr state_t init(T&& item) const {
+        return state_t{ static_cast<double>(kissra::invoke(proj, std::forward<T>(item))), 1 };
+    }
+
+    template <typename T>
+    constexpr void update(state_t& state, T&& item) const {
+        state.sum += static_cast<double>(kissra::invoke(proj, std::forward<T>(item)));
+        ++state.count;
+    }
+
+    constexpr double result(state_t state) const {
+        return state.sum / static_cast<double>(state.count);
+    }
+
+    template <typename TProjOther>
+    constexpr agg_mean_t<TProjOther> operator()(TProjOther proj) const {
+        return { proj };
+    }
+
+    [[no_unique_address]] TProj proj;
+};
+} // namespace functor
+
+namespace agg {
+constexpr kissra::functor::agg_count_t<> count;
+constexpr kissra::functor::agg_sum_t<> sum;
+constexpr kissra::functor::agg_min_t<> min;
+constexpr kissra::functor::agg_max_t<> max;
+constexpr kissra::functor::agg_mean_t<> mean;
+} // namespace agg
+} // namespace kissra
\ No newline at end of file
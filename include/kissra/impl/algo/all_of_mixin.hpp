@@ -0,0 +1,62 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
+#include "kissra/impl/algo/find_mixin.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+template <bool Negate, typename TIter, typename TFn>
+constexpr bool any_match(TIter& iter, TFn& pred) {
+    if constexpr (impl::filtered_contiguous_arithmetic_source<TIter> && impl::pure_contiguous_source<TIter> &&
+                  impl::simple_predicate<TFn>) {
+        auto [items, stage] = impl::filtered_contiguous_source(iter);
+        const auto pos = impl::find_kernel<Negate>(items, stage, pred);
+        impl::advance_contiguous_source(iter, std::min(pos + 1, items.size()));
+        return pos != items.size();
+    } else {
+        while (auto item = iter.next()) {
+            if (static_cast<bool>(kissra::invoke(pred, std::forward_like<iter_reference_t<TIter>>(*item))) != Negate) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+} // namespace impl
+
+/**
+ * Short-circuiting predicate checks (`true` for `all_of`/`none_of` of nothing), the iterator is left right after the
+ * deciding item. Over (filtered) contiguous arithmetic items `fn/cmp.hpp` and `fn/num.hpp` predicates are evaluated
+ * within a vectorized kernel a block at a time (see `impl::find_kernel`).
+ */
+template <typename Tag>
+struct all_of_mixin {
+    template <kissra::mut TSelf, typename TFn>
+        requires kissra::regular_invocable<TFn, iter_reference_t<TSelf>>
+    [[nodiscard]] constexpr bool all_of(this TSelf&& self, TFn pred) {
+        return !impl::any_match<true>(self, pred);
+    }
+
+    template <kissra::mut TSelf, typename TFn>
+        requires kissra::regular_invocable<TFn, iter_reference_t<TSelf>>
+    [[nodiscard]] constexpr bool any_of(this TSelf&& self, TFn pred) {
+        return impl::any_match<false>(self, pred);
+    }
+
+    template <kissra::mut TSelf, typename TFn>
+        requires kissra::regular_invocable<TFn, iter_reference_t<TSelf>>
+    [[nodiscard]] constexpr bool none_of(this TSelf&& self, TFn pred) {
+        return !impl::any_match<false>(self, pred);
+    }
+};
+} // namespace kissra
\ No newline at end of file
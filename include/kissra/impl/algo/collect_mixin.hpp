@@ -1,15 +1,113 @@
 #pragma once
 #include "kissra/concepts.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
 #include "kissra/impl/export.hpp"
+#include "kissra/fn/member.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/misc/optional.hpp"
+#include "kissra/misc/static_vector.hpp"
+#include "kissra/misc/type_list.hpp"
 #include "kissra/misc/utility.hpp"
 #include "kissra/type_traits.hpp"
 
 #ifndef KISSRA_MODULE
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 #endif
 
 KISSRA_EXPORT()
 namespace kissra {
+namespace impl {
+template <template <typename...> typename TTo, typename TMembersTypeList>
+struct soa_containers;
+
+template <template <typename...> typename TTo, typename... TMembers>
+struct soa_containers<TTo, tmp::type_list<TMembers...>> {
+    using type = std::tuple<TTo<std::remove_cvref_t<TMembers>>...>;
+};
+
+template <template <typename...> typename TTo, typename TArg>
+using soa_containers_t = typename soa_containers<TTo, destructured_members_type_list_t<TArg>>::type;
+
+/* Items as stored by `collect_pmr`: strings are rebound onto `std::pmr::polymorphic_allocator`, the rest is kept as is. */
+template <typename T>
+struct pmr_rebind {
+    using type = T;
+};
+
+template <typename TChar, typename TTraits>
+struct pmr_rebind<std::basic_string<TChar, TTraits, std::allocator<TChar>>> {
+    using type = std::pmr::basic_string<TChar, TTraits>;
+};
+
+template <typename T>
+using pmr_rebind_t = typename pmr_rebind<T>::type;
+
+/**
+ * Sequence containers (`std::vector`, `std::deque`, `std::list`, ...) which take the allocator right after the item
+ * type. Associative containers (comparator or hash first) and `std::basic_string` (traits first) don't.
+ */
+template <template <typename...> typename TTo, typename T>
+concept allocator_second_container = requires(TTo<T>& container, T&& item) {
+    typename TTo<T>::allocator_type;
+    container.emplace_back(std::move(item));
+};
+} // namespace impl
+
+/* What `collect_map` does with an item whose key is already in the map (multimaps keep every item regardless). */
+enum class on_duplicate {
+    /* The first item wins (same as `std::map::try_emplace`, values of later ones are not moved from). */
+    keep_first,
+    /* The last item wins (same as `std::map::insert_or_assign`). */
+    keep_last,
+    /* Throw `std::invalid_argument`. */
+    error,
+};
+
+namespace impl {
+/**
+ * Insert into a map right at `end()`: free for ordered maps fed with ascending keys (`emplace_hint` semantics), an
+ * ordinary insertion otherwise. Keys and values are forwarded into the map without intermediate pairs.
+ */
+template <on_duplicate Policy, typename TMap, typename TKey, typename TValue>
+constexpr void map_insert(TMap& map, TKey&& key, TValue&& value) {
+    if constexpr (!requires { map.try_emplace(std::forward<TKey>(key), std::forward<TValue>(value)); }) {
+        map.emplace_hint(map.end(), std::forward<TKey>(key), std::forward<TValue>(value));
+    } else if constexpr (Policy == on_duplicate::keep_first) {
+        map.try_emplace(map.end(), std::forward<TKey>(key), std::forward<TValue>(value));
+    } else if constexpr (Policy == on_duplicate::keep_last) {
+        map.insert_or_assign(map.end(), std::forward<TKey>(key), std::forward<TValue>(value));
+    } else {
+        if (!map.try_emplace(std::forward<TKey>(key), std::forward<TValue>(value)).second) {
+            throw std::invalid_argument("kissra::collect_map: duplicate key");
+        }
+    }
+}
+
+/* Append `item` to `out` (`push_back` for sequence containers, `insert` at the end for sets and such). */
+template <typename TContainer, typename TItem>
+constexpr void push_item(TContainer& out, TItem&& item) {
+    if constexpr (kissra::can_push_back<TContainer, TItem>) {
+        out.push_back(std::forward<TItem>(item));
+    } else if constexpr (kissra::can_insert<TContainer, TItem>) {
+        out.insert(std::ranges::end(out), std::forward<TItem>(item));
+    }
+}
+} // namespace impl
+
 template <typename Tag>
 struct collect_mixin {
     template <template <typename...> typename TTo = std::vector, kissra::mut TSelf>
@@ -29,14 +127,270 @@ struct collect_mixin {
          * `optional<T&&>` - should move
          */
         while (auto item = self.next()) {
-            if constexpr (kissra::can_push_back<container_t, ref_t>) {
-                result.push_back(std::forward_like<ref_t>(*item));
-            } else if constexpr (kissra::can_insert<container_t, ref_t>) {
-                result.insert(std::ranges::end(result), std::forward_like<ref_t>(*item));
+            impl::push_item(result, std::forward_like<ref_t>(*item));
+        }
+
+        return result;
+    }
+
+    /* Replace the contents of `out` with the items, its capacity is kept (no reallocations in a steady state). */
+    template <kissra::mut TSelf, typename TContainer>
+    constexpr TContainer& collect_into(this TSelf&& self, TContainer& out) {
+        out.clear();
+        return self.append_into(out);
+    }
+
+    /* Append the items to `out`. Remaining items of a contiguous iterator are inserted in bulk (a single `memcpy`). */
+    template <kissra::mut TSelf, typename TContainer>
+    constexpr TContainer& append_into(this TSelf&& self, TContainer& out) {
+        using ref_t = kissra::iter_reference_t<TSelf>;
+
+        if constexpr (kissra::sized_iterator<TSelf> && kissra::is_contiguous_v<TSelf> &&
+                      requires(std::span<std::remove_reference_t<ref_t>> items) {
+                          out.insert(std::ranges::end(out), items.begin(), items.end());
+                      }) {
+            const auto items = impl::remaining_span(self);
+            out.insert(std::ranges::end(out), items.begin(), items.end());
+            self.advance(items.size());
+        } else {
+            if constexpr (kissra::is_sized_v<TSelf> && requires { out.capacity(); }) {
+                /* Grow geometrically: appending in a loop must not reallocate on every call. */
+                const std::size_t required = std::ranges::size(out) + self.size();
+                if (required > out.capacity()) {
+                    out.reserve(std::max(required, 2 * out.capacity()));
+                }
+            }
+            while (auto item = self.next()) {
+                impl::push_item(out, std::forward_like<ref_t>(*item));
+            }
+        }
+        return out;
+    }
+
+    /**
+     * Write items into `out` until either runs out, returns the number of items written. Remaining items of a
+     * contiguous iterator are copied in bulk.
+     */
+    template <kissra::mut TSelf, typename T, std::size_t Extent>
+        requires std::is_assignable_v<T&, iter_reference_t<TSelf>>
+    constexpr std::size_t write_into(this TSelf&& self, std::span<T, Extent> out) {
+        using ref_t = kissra::iter_reference_t<TSelf>;
+
+        if constexpr (kissra::sized_iterator<TSelf> && kissra::is_contiguous_v<TSelf>) {
+            const auto items = impl::remaining_span(self);
+            const auto count = std::min(items.size(), out.size());
+            std::ranges::copy_n(items.begin(), count, out.begin());
+            self.advance(count);
+            return count;
+        } else {
+            std::size_t count = 0;
+            for (; count != out.size(); ++count) {
+                auto item = self.next();
+                if (!item) {
+                    break;
+                }
+                out[count] = std::forward_like<ref_t>(*item);
+            }
+            return count;
+        }
+    }
+
+    /**
+     * Collect into a sequence container using `alloc` (rebound onto the items), e.g.
+     * `collect(std::pmr::polymorphic_allocator{ &arena })`. Items are emplaced, i.e. uses-allocator constructed by scoped
+     * allocators (`polymorphic_allocator`, `std::scoped_allocator_adaptor`). Associative containers aren't supported:
+     * their allocator isn't the second template parameter.
+     */
+    template <template <typename...> typename TTo = std::vector, kissra::mut TSelf, typename TAlloc>
+        requires requires { typename std::allocator_traits<TAlloc>::value_type; } &&
+                 impl::allocator_second_container<TTo, kissra::iter_value_t<TSelf>>
+    [[nodiscard]] constexpr auto collect(this TSelf&& self, const TAlloc& alloc) {
+        using val_t = kissra::iter_value_t<TSelf>;
+        using alloc_t = typename std::allocator_traits<TAlloc>::template rebind_alloc<val_t>;
+        return collect_mixin::collect_with_alloc<TTo<val_t, alloc_t>>(self, alloc_t(alloc));
+    }
+
+    /**
+     * Collect into a container allocating from `resource` (e.g. a per-request `std::pmr::monotonic_buffer_resource`).
+     * Strings are stored as `std::pmr::basic_string`s, so owned outputs (e.g. of `fn::to_chars`) get their copies
+     * allocated from `resource` as well.
+     */
+    template <template <typename...> typename TTo = std::vector, kissra::mut TSelf>
+        requires impl::allocator_second_container<TTo, impl::pmr_rebind_t<kissra::iter_value_t<TSelf>>>
+    [[nodiscard]] auto collect_pmr(this TSelf&& self, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+        using val_t = impl::pmr_rebind_t<kissra::iter_value_t<TSelf>>;
+        using alloc_t = std::pmr::polymorphic_allocator<val_t>;
+        return collect_mixin::collect_with_alloc<TTo<val_t, alloc_t>>(self, alloc_t(resource));
+    }
+
+    /**
+     * Collect up to `N` items into inline storage (no heap allocations). Nothing if there are more than `N` items: the
+     * overflow is detected upfront for sized iterators, once the `N + 1`-th item is pulled otherwise.
+     */
+    template <std::size_t N, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto collect_static(this TSelf&& self) {
+        using ref_t = kissra::iter_reference_t<TSelf>;
+        using container_t = kissra::static_vector<kissra::iter_value_t<TSelf>, N>;
+        using result_t = kissra::optional<container_t>;
+
+        container_t result;
+        if constexpr (kissra::is_sized_v<TSelf>) {
+            if (self.size() > N) {
+                return result_t{};
+            }
+            while (auto item = self.next()) {
+                result.unchecked_emplace_back(std::forward_like<ref_t>(*item));
+            }
+        } else {
+            while (auto item = self.next()) {
+                if (!result.try_emplace_back(std::forward_like<ref_t>(*item))) {
+                    return result_t{};
+                }
+            }
+        }
+        return result_t{ std::move(result) };
+    }
+
+    /* Collect exactly `N` items into `std::array` (no heap allocations). Nothing if there are fewer or more of them. */
+    template <std::size_t N, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto collect_array(this TSelf&& self) {
+        using array_t = std::array<kissra::iter_value_t<TSelf>, N>;
+        using result_t = kissra::optional<array_t>;
+
+        if constexpr (N == 0) {
+            return self.next() ? result_t{} : result_t{ array_t{} };
+        } else {
+            auto items = self.template collect_static<N>();
+            if (!items || items->size() != N) {
+                return result_t{};
+            }
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return result_t{ array_t{ std::move((*items)[Is])... } };
+            }(std::make_index_sequence<N>{});
+        }
+    }
+
+    /**
+     * Structure-of-arrays collect: destructure every item (an aggregate or a tuple-like, e.g. out of `zip`) and push its
+     * members into a tuple of per-member containers in a single pass (rather than a `members<I>().collect()` pass per
+     * member).
+     */
+    template <template <typename...> typename TTo = std::vector, kissra::mut TSelf>
+        requires std::is_aggregate_v<iter_value_t<TSelf>> || kissra::tuple_like<iter_value_t<TSelf>>
+    [[nodiscard]] constexpr auto collect_soa(this TSelf&& self) {
+        using ref_t = kissra::iter_reference_t<TSelf>;
+        using result_t = impl::soa_containers_t<TTo, ref_t>;
+
+        result_t result;
+        [&]<std::size_t... MemberIdxs>(std::index_sequence<MemberIdxs...>) {
+            if constexpr (kissra::is_sized_v<TSelf>) {
+                const auto size = self.size();
+                (collect_mixin::reserve(std::get<MemberIdxs>(result), size), ...);
+            }
+
+            /* Same value category propagation as `members<I>()` (every call moves out its own member only). */
+            while (auto item = self.next()) {
+                (impl::push_item(std::get<MemberIdxs>(result), fn::member<MemberIdxs>(std::forward_like<ref_t>(*item))),
+                    ...);
             }
+        }(std::make_index_sequence<std::tuple_size_v<result_t>>{});
+
+        return result;
+    }
+
+    /* `collect_soa` into `std::vector`s. */
+    template <kissra::mut TSelf>
+        requires std::is_aggregate_v<iter_value_t<TSelf>> || kissra::tuple_like<iter_value_t<TSelf>>
+    [[nodiscard]] constexpr auto unzip(this TSelf&& self) {
+        return std::forward<TSelf>(self).template collect_soa<std::vector>();
+    }
+
+    /**
+     * Collect pairs (or any other 2-member tuple-likes/aggregates, e.g. out of `zip(keys, values)`) into a map. Buckets
+     * are reserved upfront for sized iterators.
+     */
+    template <template <typename...> typename TMap = std::unordered_map, on_duplicate Policy = on_duplicate::keep_first,
+        kissra::mut TSelf>
+        requires std::is_aggregate_v<iter_value_t<TSelf>> || kissra::tuple_like<iter_value_t<TSelf>>
+    [[nodiscard]] constexpr auto collect_map(this TSelf&& self) {
+        using ref_t = kissra::iter_reference_t<TSelf>;
+        using key_t = std::remove_cvref_t<decltype(fn::member<0>(std::declval<ref_t>()))>;
+        using mapped_t = std::remove_cvref_t<decltype(fn::member<1>(std::declval<ref_t>()))>;
+
+        TMap<key_t, mapped_t> result;
+        if constexpr (kissra::is_sized_v<TSelf>) {
+            collect_mixin::reserve(result, self.size());
+        }
+        /* Every member is forwarded separately (moved out of rvalue items). */
+        while (auto item = self.next()) {
+            impl::map_insert<Policy>(result,
+                fn::member<0>(std::forward_like<ref_t>(*item)),
+                fn::member<1>(std::forward_like<ref_t>(*item)));
+        }
+        return result;
+    }
+
+    /* Collect into a map of `key_proj(item)` to `value_proj(item)` (`key_proj` sees the item as an lvalue). */
+    template <template <typename...> typename TMap = std::unordered_map, on_duplicate Policy = on_duplicate::keep_first,
+        kissra::mut TSelf, typename TKeyProj, typename TValueProj>
+        requires kissra::regular_invocable<TKeyProj, iter_reference_t<TSelf>&> &&
+                 kissra::invocable<TValueProj, iter_reference_t<TSelf>>
+    [[nodiscard]] constexpr auto collect_map(this TSelf&& self, TKeyProj key_proj, TValueProj value_proj) {
+        using ref_t = kissra::iter_reference_t<TSelf>;
+        using key_t = std::remove_cvref_t<kissra::invoke_result_t<TKeyProj&, ref_t&>>;
+        using mapped_t = std::remove_cvref_t<kissra::invoke_result_t<TValueProj&, ref_t>>;
+
+        TMap<key_t, mapped_t> result;
+        if constexpr (kissra::is_sized_v<TSelf>) {
+            collect_mixin::reserve(result, self.size());
         }
+        while (auto item = self.next()) {
+            /* The key is taken first: `value_proj` may move out of the item. */
+            key_t key = kissra::invoke(key_proj, *item);
+            impl::map_insert<Policy>(result, std::move(key), kissra::invoke(value_proj, std::forward_like<ref_t>(*item)));
+        }
+        return result;
+    }
+
+    /* Collect into a set (`collect<std::unordered_set>()` with buckets reserved upfront and hinted insertions). */
+    template <template <typename...> typename TSet = std::unordered_set, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto collect_set(this TSelf&& self) {
+        using ref_t = kissra::iter_reference_t<TSelf>;
 
+        TSet<kissra::iter_value_t<TSelf>> result;
+        if constexpr (kissra::is_sized_v<TSelf>) {
+            collect_mixin::reserve(result, self.size());
+        }
+        while (auto item = self.next()) {
+            result.emplace_hint(result.end(), std::forward_like<ref_t>(*item));
+        }
         return result;
     }
+
+private:
+    template <typename TContainer, typename TSelf, typename TAlloc>
+    static constexpr TContainer collect_with_alloc(TSelf& self, const TAlloc& alloc) {
+        using ref_t = kissra::iter_reference_t<TSelf>;
+
+        TContainer result(alloc);
+        if constexpr (kissra::is_sized_v<TSelf>) {
+            collect_mixin::reserve(result, self.size());
+        }
+        while (auto item = self.next()) {
+            if constexpr (requires { result.emplace_back(std::forward_like<ref_t>(*item)); }) {
+                result.emplace_back(std::forward_like<ref_t>(*item));
+            } else {
+                result.emplace(std::ranges::end(result), std::forward_like<ref_t>(*item));
+            }
+        }
+        return result;
+    }
+
+    template <typename TContainer>
+    static constexpr void reserve(TContainer& out, std::size_t size) {
+        if constexpr (kissra::can_reserve<TContainer>) {
+            out.reserve(size);
+        }
+    }
 };
 } // namespace kissra
\ No newline at end of file
@@ -0,0 +1,271 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/fn/cmp.hpp"
+#include "kissra/fn/member.hpp"
+#include "kissra/fn/num.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/impl/iter/filter_iter.hpp"
+#include "kissra/impl/iter/transform_iter.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra::impl {
+/**
+ * Terminals over contiguous arithmetic items (possibly) run plain loops over raw memory instead of `next()` calls.
+ * Those loops are written to be auto-vectorized: no early exits within a block, branch-free bodies, independent
+ * accumulators.
+ */
+template <typename TIter>
+concept contiguous_arithmetic_iterator = kissra::sized_iterator<TIter> && is_contiguous_v<TIter> &&
+                                         std::is_arithmetic_v<iter_value_t<TIter>>;
+
+/* Number of items a vectorized kernel processes between two (branchy) checks of its state. */
+inline constexpr std::size_t kernel_block_size = 64;
+
+/* Remaining items of a contiguous iterator as a span (the iterator itself is NOT advanced). */
+template <typename TIter>
+    requires kissra::sized_iterator<TIter> && is_contiguous_v<TIter>
+constexpr auto remaining_span(TIter& iter) {
+    /* Fast-forward underlying cursor (e.g. see `drop_iter`) so that it is safe to use it as a raw pointer. */
+    iter.advance(0);
+    return std::span{ std::to_address(iter.underlying_cursor()), iter.size() };
+}
+
+/**
+ * A contiguous iterator possibly wrapped into `transform`s (`members<I>()` included): items are still read straight
+ * from memory, transformations are applied within the kernel loop.
+ */
+template <typename TIter>
+struct is_contiguous_source : std::bool_constant<is_contiguous_v<TIter> && is_sized_v<TIter>> {};
+
+template <typename TBaseIter, typename TFn, template <typename> typename... TMixins>
+struct is_contiguous_source<transform_iter<TBaseIter, TFn, TMixins...>> : is_contiguous_source<TBaseIter> {};
+
+template <typename TIter>
+concept contiguous_arithmetic_source = kissra::sized_iterator<TIter> &&
+                                       is_contiguous_source<std::remove_cvref_t<TIter>>::value &&
+                                       std::is_arithmetic_v<iter_value_t<TIter>>;
+
+template <typename TOuter, typename TInner>
+struct composed_projection {
+    template <typename T>
+    constexpr decltype(auto) operator()(T&& item) const {
+        return kissra::invoke(outer, kissra::invoke(inner, std::forward<T>(item)));
+    }
+
+    TOuter& outer;
+    [[no_unique_address]] TInner inner;
+};
+
+/**
+ * Remaining underlying items of a contiguous source and the projection which turns such an item into the one `iter`
+ * yields (the iterator itself is NOT advanced).
+ */
+template <typename TIter>
+    requires is_contiguous_source<TIter>::value
+constexpr auto contiguous_source(TIter& iter) {
+    if constexpr (is_contiguous_v<TIter>) {
+        return std::pair{ impl::remaining_span(iter), std::identity{} };
+    } else {
+        auto [items, inner] = impl::contiguous_source(iter.base());
+        using outer_t = std::remove_reference_t<decltype(iter.transform_fn())>;
+        return std::pair{ items, composed_projection<outer_t, decltype(inner)>{ iter.transform_fn(), inner } };
+    }
+}
+
+/**
+ * Same as above with `filter`s on top. Kernels see every underlying item as a (passes all the filters, value) pair and
+ * mask out the rejected ones rather than branching on them. Transformations below a filter are evaluated for every
+ * item anyway, predicates short-circuit exactly like stacked `filter`s do (transformations above a filter would be
+ * evaluated for rejected items too, hence they are not supported).
+ */
+template <typename TIter>
+struct is_filtered_contiguous_source : is_contiguous_source<TIter> {};
+
+template <typename TBaseIter, typename TFn, template <typename> typename... TMixins>
+struct is_filtered_contiguous_source<filter_iter<TBaseIter, TFn, TMixins...>> : is_filtered_contiguous_source<TBaseIter> {};
+
+template <typename TIter>
+concept filtered_contiguous_arithmetic_source = kissra::iterator<TIter> &&
+                                                is_filtered_contiguous_source<std::remove_cvref_t<TIter>>::value &&
+                                                std::is_arithmetic_v<iter_value_t<TIter>>;
+
+/* Items compared within kernels by `find`-like terminals: arithmetic values and pointers. */
+template <typename T>
+concept scalar_item = std::is_arithmetic_v<T> || std::is_pointer_v<T>;
+
+template <typename TIter>
+concept contiguous_scalar_source = kissra::sized_iterator<TIter> &&
+                                   is_contiguous_source<std::remove_cvref_t<TIter>>::value &&
+                                   scalar_item<iter_value_t<TIter>>;
+
+template <typename TIter>
+concept filtered_contiguous_scalar_source = kissra::iterator<TIter> &&
+                                            is_filtered_contiguous_source<std::remove_cvref_t<TIter>>::value &&
+                                            scalar_item<iter_value_t<TIter>>;
+
+template <typename TProj>
+struct unfiltered_stage {
+    template <typename T>
+    constexpr auto operator()(T&& item) const {
+        using value_t = std::remove_cvref_t<decltype(kissra::invoke(proj, std::forward<T>(item)))>;
+        return std::pair<bool, value_t>{ true, kissra::invoke(proj, std::forward<T>(item)) };
+    }
+
+    [[no_unique_address]] TProj proj;
+};
+
+template <typename TFn, typename TRef, typename TInner>
+struct filtered_stage {
+    template <typename T>
+    constexpr auto operator()(T&& item) const {
+        auto result = inner(std::forward<T>(item));
+        result.first = result.first && static_cast<bool>(kissra::invoke(pred, std::forward_like<TRef>(result.second)));
+        return result;
+    }
+
+    TFn& pred;
+    [[no_unique_address]] TInner inner;
+};
+
+/* Remaining underlying items of a filtered contiguous source and the stage which maps such an item onto a pair above. */
+template <typename TIter>
+    requires is_filtered_contiguous_source<TIter>::value
+constexpr auto filtered_contiguous_source(TIter& iter) {
+    if constexpr (is_contiguous_source<TIter>::value) {
+        auto [items, proj] = impl::contiguous_source(iter);
+        return std::pair{ items, unfiltered_stage<decltype(proj)>{ proj } };
+    } else {
+        auto [items, inner] = impl::filtered_contiguous_source(iter.base());
+        using pred_t = std::remove_reference_t<decltype(iter.filter_fn())>;
+        using ref_t = kissra::iter_reference_t<std::remove_reference_t<decltype(iter.base())>>;
+        return std::pair{ items, filtered_stage<pred_t, ref_t, decltype(inner)>{ iter.filter_fn(), inner } };
+    }
+}
+
+/* Skip `n` underlying items of a (filtered) contiguous source which have been processed by a kernel. */
+template <typename TIter>
+constexpr void advance_contiguous_source(TIter& iter, std::size_t n) {
+    if constexpr (is_contiguous_v<TIter>) {
+        iter.advance(n);
+    } else {
+        impl::advance_contiguous_source(iter.base(), n);
+    }
+}
+
+/* Exhaust a (filtered) contiguous source whose items have been processed by a kernel. */
+template <typename TIter>
+constexpr void consume_contiguous_source(TIter& iter) {
+    if constexpr (is_contiguous_v<TIter>) {
+        iter.advance(iter.size());
+    } else {
+        impl::consume_contiguous_source(iter.base());
+    }
+}
+
+/**
+ * `fn/cmp.hpp` & `fn/num.hpp` predicates against arithmetic values: pure, cheap and branch-free. Kernels evaluate those
+ * for every item (including masked out ones) and turn them into compare masks.
+ */
+template <typename TFn>
+struct is_simple_predicate : std::false_type {};
+
+template <auto Rhs>
+struct is_simple_predicate<kissra::functor::lt_c_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<decltype(Rhs)>> {};
+
+template <typename Rhs>
+struct is_simple_predicate<kissra::functor::lt_val_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<Rhs>> {};
+
+template <auto Rhs>
+struct is_simple_predicate<kissra::functor::le_c_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<decltype(Rhs)>> {};
+
+template <typename Rhs>
+struct is_simple_predicate<kissra::functor::le_val_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<Rhs>> {};
+
+template <auto Rhs>
+struct is_simple_predicate<kissra::functor::gt_c_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<decltype(Rhs)>> {};
+
+template <typename Rhs>
+struct is_simple_predicate<kissra::functor::gt_val_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<Rhs>> {};
+
+template <auto Rhs>
+struct is_simple_predicate<kissra::functor::ge_c_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<decltype(Rhs)>> {};
+
+template <typename Rhs>
+struct is_simple_predicate<kissra::functor::ge_val_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<Rhs>> {};
+
+template <auto Rhs>
+struct is_simple_predicate<kissra::functor::eq_c_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<decltype(Rhs)>> {};
+
+template <typename Rhs>
+struct is_simple_predicate<kissra::functor::eq_val_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<Rhs>> {};
+
+template <auto Rhs>
+struct is_simple_predicate<kissra::functor::ne_c_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<decltype(Rhs)>> {};
+
+template <typename Rhs>
+struct is_simple_predicate<kissra::functor::ne_val_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<Rhs>> {};
+
+template <auto Rhs>
+struct is_simple_predicate<kissra::functor::divisible_by_c_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<decltype(Rhs)>> {};
+
+template <typename Rhs>
+struct is_simple_predicate<kissra::functor::divisible_by_val_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<Rhs>> {};
+
+template <auto Rhs>
+struct is_simple_predicate<kissra::functor::not_divisible_by_c_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<decltype(Rhs)>> {};
+
+template <typename Rhs>
+struct is_simple_predicate<kissra::functor::not_divisible_by_val_t<Rhs>> : std::bool_constant<std::is_arithmetic_v<Rhs>> {};
+
+template <>
+struct is_simple_predicate<kissra::functor::even_t> : std::true_type {};
+
+template <>
+struct is_simple_predicate<kissra::functor::odd_t> : std::true_type {};
+
+template <typename TFn>
+concept simple_predicate = is_simple_predicate<std::remove_cvref_t<TFn>>::value;
+
+/**
+ * (Filtered) contiguous sources without user functors: `members<I>()` projections and `simple_predicate` filters only.
+ * Short-circuiting kernels (`find`, `any_of`, ...) evaluate the stages of a whole block past the deciding item (and the
+ * deciding item once more on `next()`), which is only unobservable for those.
+ */
+template <typename TIter>
+struct is_pure_contiguous_source : std::bool_constant<is_contiguous_v<TIter> && is_sized_v<TIter>> {};
+
+template <typename TBaseIter, std::size_t MemberIdx, template <typename> typename... TMixins>
+struct is_pure_contiguous_source<transform_iter<TBaseIter, kissra::functor::member_t<MemberIdx>, TMixins...>>
+    : is_pure_contiguous_source<TBaseIter> {};
+
+template <typename TBaseIter, typename TFn, template <typename> typename... TMixins>
+struct is_pure_contiguous_source<filter_iter<TBaseIter, TFn, TMixins...>>
+    : std::bool_constant<simple_predicate<TFn> && is_pure_contiguous_source<TBaseIter>::value> {};
+
+template <typename TIter>
+concept pure_contiguous_source = is_pure_contiguous_source<std::remove_cvref_t<TIter>>::value;
+
+/* Comparators known to be a plain `<` / `>` (cheap & branch-free for arithmetic types). */
+template <typename TCmp>
+concept natural_less = std::same_as<TCmp, std::ranges::less> || std::same_as<TCmp, std::less<>> ||
+                       std::same_as<TCmp, kissra::functor::lt_t>;
+
+template <typename TCmp>
+concept natural_greater = std::same_as<TCmp, std::ranges::greater> || std::same_as<TCmp, std::greater<>> ||
+                          std::same_as<TCmp, kissra::functor::gt_t>;
+
+template <typename TCmp>
+concept natural_order = natural_less<TCmp> || natural_greater<TCmp>;
+} // namespace kissra::impl
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+struct always_true {
+    template <typename T>
+    static constexpr bool operator()(T&&) {
+        return true;
+    }
+};
+
+/**
+ * Number of (filtered) contiguous items `pred` holds for. Every item adds its 0/1 match to one of the lanes: compare
+ * masks subtracted from vector counters, i.e. a popcount of the mask per block in effect. Narrow lane counters are
+ * flushed before they could overflow.
+ */
+template <typename U, typename TStage, typename TPred>
+constexpr std::size_t count_kernel(std::span<U> items, TStage& stage, TPred& pred) {
+    constexpr std::size_t lanes = 8;
+    constexpr std::size_t flush_every = lanes << 20;
+
+    const auto matches = [&](U& item) -> std::uint32_t {
+        const auto [passes, value] = stage(item);
+        return passes & static_cast<bool>(kissra::invoke(pred, value));
+    };
+
+    const std::size_t size = items.size();
+    std::size_t total = 0;
+    std::size_t i = 0;
+    while (size - i >= lanes) {
+        const std::size_t chunk_end = i + std::min((size - i) / lanes * lanes, flush_every);
+        std::uint32_t acc[lanes]{};
+        for (; i != chunk_end; i += lanes) {
+            for (std::size_t l = 0; l != lanes; ++l) {
+                acc[l] += matches(items[i + l]);
+            }
+        }
+        for (std::size_t l = 0; l != lanes; ++l) {
+            total += acc[l];
+        }
+    }
+    for (; i < size; ++i) {
+        total += matches(items[i]);
+    }
+    return total;
+}
+} // namespace impl
+
+template <typename Tag>
+struct count_mixin {
+    /* Number of (remaining) items. O(1) for sized iterators, items are skipped over rather than evaluated otherwise. */
+    template <kissra::mut TSelf>
+    [[nodiscard]] constexpr std::size_t count(this TSelf&& self) {
+        if constexpr (kissra::is_sized_v<TSelf>) {
+            return self.size();
+        } else if constexpr (impl::filtered_contiguous_arithmetic_source<TSelf>) {
+            auto [items, stage] = impl::filtered_contiguous_source(self);
+            impl::always_true pred;
+            const auto result = impl::count_kernel(items, stage, pred);
+            impl::consume_contiguous_source(self);
+            return result;
+        } else {
+            return self.advance(std::numeric_limits<std::size_t>::max());
+        }
+    }
+
+    /**
+     * Number of items `pred` holds for. Over (filtered) contiguous arithmetic items `fn/cmp.hpp` and `fn/num.hpp`
+     * predicates (`fn::gt_c<0>`, `fn::even`, `fn::divisible_by(3)`, ...) are evaluated within a vectorized kernel.
+     */
+    template <kissra::mut TSelf, typename TFn>
+        requires kissra::regular_invocable<TFn, iter_reference_t<TSelf>>
+    [[nodiscard]] constexpr std::size_t count_if(this TSelf&& self, TFn pred) {
+        if constexpr (impl::filtered_contiguous_arithmetic_source<TSelf> && impl::simple_predicate<TFn>) {
+            auto [items, stage] = impl::filtered_contiguous_source(self);
+            const auto result = impl::count_kernel(items, stage, pred);
+            impl::consume_contiguous_source(self);
+            return result;
+        } else {
+            std::size_t result = 0;
+            while (auto item = self.next()) {
+                result += static_cast<bool>(kissra::invoke(pred, std::forward_like<iter_reference_t<TSelf>>(*item)));
+            }
+            return result;
+        }
+    }
+};
+} // namespace kissra
\ No newline at end of file
@@ -1,36 +1,150 @@
 #pragma once
 #include "kissra/concepts.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
 #include "kissra/impl/export.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/misc/optional.hpp"
 #include "kissra/type_traits.hpp"
 
 #ifndef KISSRA_MODULE
+#include <algorithm>
 #include <concepts>
+#include <cstddef>
+#include <cstring>
 #include <functional>
+#include <span>
+#include <type_traits>
 #endif
 
 KISSRA_EXPORT()
 namespace kissra {
+namespace impl {
+/**
+ * Position of the first (filtered) contiguous item `pred` holds for (or doesn't if `Negate`), `items.size()` if none.
+ * Blocks of `kernel_block_size` items are checked branch-free (OR-ed compare masks) and only the block which contains
+ * a match is rescanned for its position.
+ */
+template <bool Negate, typename U, typename TStage, typename TPred>
+constexpr std::size_t find_kernel(std::span<U> items, TStage& stage, TPred& pred) {
+    const auto matches = [&](U& item) -> bool {
+        const auto [passes, value] = stage(item);
+        return passes & (static_cast<bool>(kissra::invoke(pred, value)) != Negate);
+    };
+
+    const std::size_t size = items.size();
+    std::size_t i = 0;
+    for (; i + kernel_block_size <= size; i += kernel_block_size) {
+        bool any = false;
+        for (std::size_t j = 0; j != kernel_block_size; ++j) {
+            any |= matches(items[i + j]);
+        }
+        if (any) {
+            break;
+        }
+    }
+    for (; i < size; ++i) {
+        if (matches(items[i])) {
+            return i;
+        }
+    }
+    return size;
+}
+
+/* Same as above scanning backward: position of the last match, `items.size()` if none. */
+template <bool Negate, typename U, typename TProj, typename TPred>
+constexpr std::size_t find_last_kernel(std::span<U> items, TProj& proj, TPred& pred) {
+    const auto matches = [&](U& item) -> bool {
+        return static_cast<bool>(kissra::invoke(pred, kissra::invoke(proj, item))) != Negate;
+    };
+
+    std::size_t i = items.size();
+    for (; i >= kernel_block_size; i -= kernel_block_size) {
+        bool any = false;
+        for (std::size_t j = i - kernel_block_size; j != i; ++j) {
+            any |= matches(items[j]);
+        }
+        if (any) {
+            break;
+        }
+    }
+    while (i != 0) {
+        if (matches(items[--i])) {
+            return i;
+        }
+    }
+    return items.size();
+}
+
+/* Bytes compared against an integer: there is a single byte value (if any) `== value` holds for. */
+template <typename U, typename TValue>
+concept byte_searchable = std::integral<U> && sizeof(U) == 1 && !std::same_as<U, bool> && std::integral<TValue> &&
+                          !std::same_as<TValue, bool>;
+
+/* `std::memchr` lookup (hand-vectorized by libc implementations), `items.size()` if there is no match. */
+template <typename U, typename TValue>
+std::size_t find_byte(std::span<U> items, const TValue& value) {
+    using byte_t = std::remove_cv_t<U>;
+    const auto byte = static_cast<byte_t>(value);
+    if (!(byte == value)) {
+        return items.size();
+    }
+    const void* found = std::memchr(items.data(), static_cast<unsigned char>(byte), items.size());
+    return found ? std::size_t(static_cast<const byte_t*>(found) - items.data()) : items.size();
+}
+
+/* Position of the first (filtered) contiguous item equal (or not if `Negate`) to `value`, `items.size()` if none. */
+template <bool Negate, typename U, typename TStage, typename TValue>
+constexpr std::size_t find_value_kernel(std::span<U> items, TStage& stage, const TValue& value) {
+    if constexpr (!Negate && std::same_as<TStage, unfiltered_stage<std::identity>> &&
+                  impl::byte_searchable<std::remove_cv_t<U>, TValue>) {
+        if !consteval {
+            return impl::find_byte(items, value);
+        }
+    }
+    auto pred = [&](const auto& item) { return item == value; };
+    return impl::find_kernel<Negate>(items, stage, pred);
+}
+} // namespace impl
+
+/**
+ * Searches are short-circuiting: an iterator is left right after the found item (or exhausted if there is none).
+ * Over (filtered) contiguous arithmetic or pointer items, lookups of a value and of `fn/cmp.hpp`/`fn/num.hpp`
+ * predicates (`fn::gt_c<0>`, `fn::eq(x)`, `fn::even`, ...) run within a vectorized kernel, unless there are user
+ * functors in the pipeline (see `impl::pure_contiguous_source`).
+ */
 template <typename Tag>
 struct find_mixin {
     template <kissra::mut TSelf, typename TValue>
     constexpr auto find(this TSelf&& self, const TValue& value) {
-        while (auto item = self.next()) {
-            if (eq(*item, value)) {
-                return item;
+        if constexpr (impl::filtered_contiguous_scalar_source<TSelf> && impl::pure_contiguous_source<TSelf> &&
+                      impl::scalar_item<TValue>) {
+            auto [items, stage] = impl::filtered_contiguous_source(self);
+            return find_mixin::found_at(self, impl::find_value_kernel<false>(items, stage, value));
+        } else {
+            while (auto item = self.next()) {
+                if (eq(*item, value)) {
+                    return item;
+                }
             }
+            return iter_result_t<TSelf>{};
         }
-        return iter_result_t<TSelf>{};
     }
 
     template <kissra::mut TSelf, typename TFn>
         requires kissra::regular_invocable<TFn, iter_reference_t<TSelf>>
     constexpr auto find_if(this TSelf&& self, TFn fn) {
-        while (auto item = self.next()) {
-            if (kissra::invoke(fn, std::forward_like<iter_reference_t<TSelf>>(*item))) {
-                return item;
+        if constexpr (impl::filtered_contiguous_arithmetic_source<TSelf> && impl::pure_contiguous_source<TSelf> &&
+                      impl::simple_predicate<TFn>) {
+            auto [items, stage] = impl::filtered_contiguous_source(self);
+            return find_mixin::found_at(self, impl::find_kernel<false>(items, stage, fn));
+        } else {
+            while (auto item = self.next()) {
+                if (kissra::invoke(fn, std::forward_like<iter_reference_t<TSelf>>(*item))) {
+                    return item;
+                }
             }
+            return iter_result_t<TSelf>{};
         }
-        return iter_result_t<TSelf>{};
     }
 
     template <kissra::mut TSelf, typename TValue, typename TProj>
@@ -46,23 +160,35 @@ struct find_mixin {
 
     template <kissra::mut TSelf, typename TValue>
     constexpr auto find_not(this TSelf&& self, TValue&& value) {
-        while (auto item = self.next()) {
-            if (!eq(*item, value)) {
-                return item;
+        if constexpr (impl::filtered_contiguous_scalar_source<TSelf> && impl::pure_contiguous_source<TSelf> &&
+                      impl::scalar_item<std::remove_cvref_t<TValue>>) {
+            auto [items, stage] = impl::filtered_contiguous_source(self);
+            return find_mixin::found_at(self, impl::find_value_kernel<true>(items, stage, value));
+        } else {
+            while (auto item = self.next()) {
+                if (!eq(*item, value)) {
+                    return item;
+                }
             }
+            return iter_result_t<TSelf>{};
         }
-        return iter_result_t<TSelf>{};
     }
 
     template <kissra::mut TSelf, typename TFn>
         requires kissra::regular_invocable<TFn, iter_reference_t<TSelf>>
     constexpr auto find_if_not(this TSelf&& self, TFn fn) {
-        while (auto item = self.next()) {
-            if (!kissra::invoke(fn, std::forward_like<iter_reference_t<TSelf>>(*item))) {
-                return item;
+        if constexpr (impl::filtered_contiguous_arithmetic_source<TSelf> && impl::pure_contiguous_source<TSelf> &&
+                      impl::simple_predicate<TFn>) {
+            auto [items, stage] = impl::filtered_contiguous_source(self);
+            return find_mixin::found_at(self, impl::find_kernel<true>(items, stage, fn));
+        } else {
+            while (auto item = self.next()) {
+                if (!kissra::invoke(fn, std::forward_like<iter_reference_t<TSelf>>(*item))) {
+                    return item;
+                }
             }
+            return iter_result_t<TSelf>{};
         }
-        return iter_result_t<TSelf>{};
     }
 
     template <kissra::mut TSelf, typename TValue, typename TProj>
@@ -76,6 +202,80 @@ struct find_mixin {
         return iter_result_t<TSelf>{};
     }
 
+    /* The last item equal to `value` (searched from the back, the iterator is left right before the found item). */
+    template <kissra::mut TSelf, typename TValue>
+        requires is_common_v<TSelf> && is_bidir_v<TSelf>
+    constexpr auto find_last(this TSelf&& self, const TValue& value) {
+        if constexpr (impl::contiguous_scalar_source<TSelf> && impl::pure_contiguous_source<TSelf> &&
+                      impl::scalar_item<TValue>) {
+            auto [items, proj] = impl::contiguous_source(self);
+            auto pred = [&](const auto& item) { return item == value; };
+            return find_mixin::found_last_at(self, impl::find_last_kernel<false>(items, proj, pred), items.size());
+        } else {
+            while (auto item = self.next_back()) {
+                if (eq(*item, value)) {
+                    return item;
+                }
+            }
+            return iter_result_t<TSelf>{};
+        }
+    }
+
+    /* The last item `fn` holds for (searched from the back, the iterator is left right before the found item). */
+    template <kissra::mut TSelf, typename TFn>
+        requires is_common_v<TSelf> && is_bidir_v<TSelf> && kissra::regular_invocable<TFn, iter_reference_t<TSelf>>
+    constexpr auto find_last_if(this TSelf&& self, TFn fn) {
+        if constexpr (impl::contiguous_arithmetic_source<TSelf> && impl::pure_contiguous_source<TSelf> &&
+                      impl::simple_predicate<TFn>) {
+            auto [items, proj] = impl::contiguous_source(self);
+            return find_mixin::found_last_at(self, impl::find_last_kernel<false>(items, proj, fn), items.size());
+        } else {
+            while (auto item = self.next_back()) {
+                if (kissra::invoke(fn, std::forward_like<iter_reference_t<TSelf>>(*item))) {
+                    return item;
+                }
+            }
+            return iter_result_t<TSelf>{};
+        }
+    }
+
+    /* Position (counting from the current front) of the first item equal to `value`. */
+    template <kissra::mut TSelf, typename TValue>
+    constexpr kissra::optional<std::size_t> position(this TSelf&& self, const TValue& value) {
+        if constexpr (impl::contiguous_scalar_source<TSelf> && impl::pure_contiguous_source<TSelf> &&
+                      impl::scalar_item<TValue>) {
+            auto [items, proj] = impl::contiguous_source(self);
+            impl::unfiltered_stage<decltype(proj)> stage{ proj };
+            return find_mixin::position_at(self, impl::find_value_kernel<false>(items, stage, value), items.size());
+        } else {
+            for (std::size_t i = 0; auto item = self.next(); ++i) {
+                if (eq(*item, value)) {
+                    return i;
+                }
+            }
+            return {};
+        }
+    }
+
+    /* Position (counting from the current front) of the first item `fn` holds for. */
+    template <kissra::mut TSelf, typename TFn>
+        requires kissra::regular_invocable<TFn, iter_reference_t<TSelf>>
+    constexpr kissra::optional<std::size_t> find_index(this TSelf&& self, TFn fn) {
+        if constexpr (impl::contiguous_arithmetic_source<TSelf> && impl::pure_contiguous_source<TSelf> &&
+                      impl::simple_predicate<TFn>) {
+            auto [items, proj] = impl::contiguous_source(self);
+            impl::unfiltered_stage<decltype(proj)> stage{ proj };
+            return find_mixin::position_at(self, impl::find_kernel<false>(items, stage, fn), items.size());
+        } else {
+            for (std::size_t i = 0; auto item = self.next(); ++i) {
+                if (kissra::invoke(fn, std::forward_like<iter_reference_t<TSelf>>(*item))) {
+                    return i;
+                }
+            }
+            return {};
+        }
+    }
+
     template <kissra::mut TSelf, typename TValue>
     constexpr bool contains(this TSelf&& self, const TValue& value) {
         return self.find(value).has_value();
@@ -119,5 +319,24 @@ private:
             return !(l != r);
         }
     }
+
+    /* Skip underlying items up to the one found by a kernel and yield it as usual (nothing if the source is exhausted). */
+    template <typename TSelf>
+    static constexpr auto found_at(TSelf& self, std::size_t pos) {
+        impl::advance_contiguous_source(self, pos);
+        return self.next();
+    }
+
+    template <typename TSelf>
+    static constexpr auto found_last_at(TSelf& self, std::size_t pos, std::size_t size) {
+        self.advance_back(pos == size ? size : size - 1 - pos);
+        return self.next_back();
+    }
+
+    template <typename TSelf>
+    static constexpr kissra::optional<std::size_t> position_at(TSelf& self, std::size_t pos, std::size_t size) {
+        impl::advance_contiguous_source(self, std::min(pos + 1, size));
+        return pos != size ? kissra::optional<std::size_t>{ pos } : kissra::optional<std::size_t>{};
+    }
 };
 } // namespace kissra
\ No newline at end of file
@@ -0,0 +1,133 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/fn/agg.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/flat_hash_map.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/misc/utility.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/* Upper bound of the upfront table reservation (the number of groups is not known, the number of items is). */
+inline constexpr std::size_t group_by_presize_limit = 1uz << 16;
+
+/* Converts into whatever `fn()` returns: lets `try_emplace` construct a value in place only if it is missing. */
+template <typename TFn>
+struct lazy_value {
+    constexpr operator std::invoke_result_t<TFn&>() const {
+        return fn();
+    }
+
+    TFn& fn;
+};
+
+template <typename TIter, typename TKeyProj>
+class group_by_builder {
+public:
+    constexpr group_by_builder(TIter&& iter, TKeyProj key_proj)
+        : iter(std::forward<TIter>(iter))
+        , key_proj(key_proj) {}
+
+    /**
+     * Per key `aggs` results (a tuple of them if there are several aggregates) in a `flat_hash_map` ordered by the
+     * first occurrence of every key, e.g. `group_by(fn::member<0>).aggregate(agg::count, agg::sum(fn::member<1>))`.
+     */
+    template <typename... TAggs>
+        requires(sizeof...(TAggs) != 0)
+    [[nodiscard]] constexpr auto aggregate(TAggs... aggs) {
+        using ref_t = kissra::iter_reference_t<iter_t>;
+        using state_t = std::tuple<decltype(aggs.init(std::declval<ref_t&>()))...>;
+
+        auto table = this->accumulate<state_t>(
+            [&](auto& item) { return state_t{ aggs.init(item)... }; },
+            [&](state_t& state, auto& item) {
+                std::apply([&](auto&... states) { (aggs.update(states, item), ...); }, state);
+            });
+
+        return std::move(table).transform_values([&](state_t&& state) {
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                if constexpr (sizeof...(TAggs) == 1) {
+                    return aggs...[0].result(std::move(std::get<0>(state)));
+                } else {
+                    return std::tuple{ aggs...[Is].result(std::move(std::get<Is>(state)))... };
+                }
+            }(std::index_sequence_for<TAggs...>{});
+        });
+    }
+
+    /* Per key fold of `value_proj`-ected items with `op` (the first value of a group is its initial state). */
+    template <typename TValueProj, typename TOp>
+    [[nodiscard]] constexpr auto reduce(TValueProj value_proj, TOp op) {
+        using ref_t = kissra::iter_reference_t<iter_t>;
+        using value_t = std::remove_cvref_t<kissra::invoke_result_t<TValueProj&, ref_t>>;
+
+        return this->accumulate<value_t>(
+            [&](auto& item) { return value_t(kissra::invoke(value_proj, std::forward_like<ref_t>(item))); },
+            [&](value_t& state, auto& item) {
+                state = std::invoke(op, std::move(state), kissra::invoke(value_proj, std::forward_like<ref_t>(item)));
+            });
+    }
+
+private:
+    using iter_t = std::remove_cvref_t<TIter>;
+
+    /* Single pass over the items: one key hash per item, group states are stored inline in the table. */
+    template <typename TState, typename TInit, typename TUpdate>
+    constexpr auto accumulate(TInit init, TUpdate update) {
+        using ref_t = kissra::iter_reference_t<iter_t>;
+        using key_t = std::remove_cvref_t<kissra::invoke_result_t<TKeyProj&, ref_t&>>;
+
+        kissra::flat_hash_map<key_t, TState> table;
+        if constexpr (kissra::is_sized_v<iter_t>) {
+            table.reserve(std::min(this->iter.size(), impl::group_by_presize_limit));
+        }
+
+        while (auto item = this->iter.next()) {
+            auto&& key = kissra::invoke(this->key_proj, *item);
+            const auto hash = table.hash_of(key);
+            auto make_state = [&] { return init(*item); };
+            auto [entry, inserted] = table.try_emplace_hashed(hash, KISSRA_FWD(key), impl::lazy_value{ make_state });
+            if (!inserted) {
+                update(entry.second, *item);
+            }
+        }
+        return table;
+    }
+
+    TIter iter;
+    [[no_unique_address]] TKeyProj key_proj;
+};
+} // namespace impl
+
+template <typename Tag>
+struct group_by_mixin {
+    /**
+     * Hash group-by terminal: `group_by(key_proj).aggregate(aggs...)` or `group_by(key_proj).reduce(value_proj, op)`.
+     * Groups are accumulated in a single pass within an open-addressing table (no allocation per key), see `agg::*`.
+     */
+    template <kissra::mut TSelf, typename TKeyProj>
+        requires kissra::regular_invocable<TKeyProj, iter_reference_t<TSelf>&>
+    [[nodiscard]] constexpr auto group_by(this TSelf&& self, TKeyProj key_proj) {
+        return impl::group_by_builder<TSelf, TKeyProj>{ std::forward<TSelf>(self), key_proj };
+    }
+
+    /* `group_by(key_proj).reduce(value_proj, op)`. */
+    template <kissra::mut TSelf, typename TKeyProj, typename TValueProj, typename TOp>
+        requires kissra::regular_invocable<TKeyProj, iter_reference_t<TSelf>&> &&
+                 kissra::regular_invocable<TValueProj, iter_reference_t<TSelf>>
+    [[nodiscard]] constexpr auto reduce_by_key(this TSelf&& self, TKeyProj key_proj, TValueProj value_proj, TOp op) {
+        return std::forward<TSelf>(self).group_by(key_proj).reduce(value_proj, op);
+    }
+};
+} // namespace kissra
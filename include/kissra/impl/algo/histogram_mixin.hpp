@@ -0,0 +1,249 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/fn/agg.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
+#include "kissra/impl/algo/minmax_mixin.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/impl/iter/distinct_iter.hpp"
+#include "kissra/misc/flat_hash_map.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/* Largest key domain (number of bins) counted within dense arrays rather than a hash map. */
+inline constexpr std::size_t dense_count_limit = 1uz << 16;
+
+/**
+ * Dense counters of indices within `[0, domain)`. Consecutive items are counted in different tables (summed up in the
+ * end) so that a run of the same index (skewed data) doesn't serialize on the load-increment-store of a single counter.
+ * Counters are 32-bit (4 tables of the largest domain take 1MiB) and are flushed into the totals before they overflow.
+ */
+class interleaved_counts {
+public:
+    static constexpr std::size_t tables = 4;
+
+    constexpr explicit interleaved_counts(std::size_t domain)
+        : domain(domain)
+        , counts(tables * domain)
+        , totals(domain) {}
+
+    constexpr void add(std::size_t index) {
+        ++this->counts[this->table * this->domain + index];
+        this->table = (this->table + 1) % tables;
+        if (++this->pending == flush_every) {
+            this->flush();
+        }
+    }
+
+    template <typename U, typename TIndexOf>
+    constexpr void add_all(std::span<U> items, TIndexOf&& index_of) {
+        if (this->pending != 0) {
+            this->flush();
+        }
+        std::uint32_t* counts = this->counts.data();
+        const std::size_t size = items.size();
+        std::size_t i = 0;
+        while (size - i >= tables) {
+            const std::size_t chunk_end = i + std::min((size - i) / tables * tables, flush_every);
+            for (; i != chunk_end; i += tables) {
+                for (std::size_t t = 0; t != tables; ++t) {
+                    ++counts[t * this->domain + index_of(items[i + t])];
+                }
+            }
+            this->flush();
+        }
+        for (; i != size; ++i) {
+            this->add(index_of(items[i]));
+        }
+    }
+
+    /* Count per index. */
+    constexpr std::vector<std::size_t> result() && {
+        this->flush();
+        return std::move(this->totals);
+    }
+
+private:
+    /* Every table gets at most `flush_every / tables` increments in between: far below `2^32`. */
+    static constexpr std::size_t flush_every = std::size_t(1) << 31;
+
+    constexpr void flush() {
+        for (std::size_t t = 0; t != tables; ++t) {
+            for (std::size_t i = 0; i != this->domain; ++i) {
+                this->totals[i] += std::exchange(this->counts[t * this->domain + i], 0);
+            }
+        }
+        this->pending = 0;
+    }
+
+    std::size_t domain;
+    std::vector<std::uint32_t> counts;
+    std::vector<std::size_t> totals;
+    std::size_t table = 0;
+    std::size_t pending = 0;
+};
+
+/**
+ * Index of the bin of a value within `[lo, hi]` split into `bins` equal-width bins (`hi` belongs to the last one), out of
+ * range values and NaNs go to the extra bin `bins`. Branch-free (selects only).
+ */
+struct bin_index {
+    template <typename T>
+    constexpr std::size_t operator()(T value) const {
+        const double x = static_cast<double>(value);
+        const bool in_range = x >= this->lo && x <= this->hi;
+        const auto bin = static_cast<std::size_t>(in_range ? (x - this->lo) * this->scale : 0.0);
+        return in_range ? std::min(bin, this->bins - 1) : this->bins;
+    }
+
+    double lo;
+    double hi;
+    double scale;
+    std::size_t bins;
+};
+
+template <typename TIter>
+constexpr std::vector<std::size_t> histogram(TIter& iter, std::size_t bins, double lo, double hi) {
+    if (bins == 0) {
+        throw std::invalid_argument("kissra::histogram: zero bins");
+    }
+    const bin_index index_of{ lo, hi, hi > lo ? double(bins) / (hi - lo) : 0.0, bins };
+
+    std::vector<std::size_t> result;
+    if (bins < impl::dense_count_limit) {
+        interleaved_counts counts{ bins + 1 };
+        if constexpr (impl::contiguous_arithmetic_source<TIter>) {
+            auto [items, proj] = impl::contiguous_source(iter);
+            counts.add_all(items, [&](auto& item) { return index_of(kissra::invoke(proj, item)); });
+            iter.advance(items.size());
+        } else {
+            while (auto item = iter.next()) {
+                counts.add(index_of(*item));
+            }
+        }
+        result = std::move(counts).result();
+    } else {
+        result.resize(bins + 1);
+        while (auto item = iter.next()) {
+            ++result[index_of(*item)];
+        }
+    }
+    result.pop_back();
+    return result;
+}
+
+/* Non-zero dense counts (as accumulated by `interleaved_counts`) keyed by `key_at(index)`, in the ascending order. */
+template <typename TKey, typename TKeyAt>
+constexpr auto dense_value_counts(std::vector<std::size_t>&& counts, TKeyAt key_at) {
+    kissra::flat_hash_map<TKey, std::size_t> result;
+    result.reserve(static_cast<std::size_t>(std::ranges::count_if(counts, [](std::size_t n) { return n != 0; })));
+    for (std::size_t i = 0; i != counts.size(); ++i) {
+        if (counts[i] != 0) {
+            result.try_emplace(key_at(i), counts[i]);
+        }
+    }
+    return result;
+}
+
+template <typename TIter, typename TProj>
+constexpr auto value_counts(TIter& iter, TProj& proj) {
+    using ref_t = kissra::iter_reference_t<TIter>;
+    using key_t = std::remove_cvref_t<kissra::invoke_result_t<TProj&, ref_t&>>;
+
+    if constexpr (impl::small_integral_key<key_t>) {
+        constexpr std::int64_t lo = std::numeric_limits<key_t>::min();
+        constexpr std::size_t domain = std::size_t(std::int64_t(std::numeric_limits<key_t>::max()) - lo + 1);
+        const auto index_of = [](key_t key) { return static_cast<std::size_t>(std::int64_t(key) - lo); };
+
+        interleaved_counts counts{ domain };
+        if constexpr (impl::contiguous_arithmetic_source<TIter>) {
+            auto [items, item_proj] = impl::contiguous_source(iter);
+            counts.add_all(items, [&](auto& item) {
+                auto&& value = kissra::invoke(item_proj, item);
+                return index_of(kissra::invoke(proj, value));
+            });
+            iter.advance(items.size());
+        } else {
+            while (auto item = iter.next()) {
+                counts.add(index_of(kissra::invoke(proj, *item)));
+            }
+        }
+        return impl::dense_value_counts<key_t>(std::move(counts).result(), [](std::size_t i) {
+            return static_cast<key_t>(lo + static_cast<std::int64_t>(i));
+        });
+    } else if constexpr (std::integral<key_t> && impl::contiguous_arithmetic_source<TIter>) {
+        /* Items can be read twice: one more (vectorized) pass finds out whether the keys span a small range. */
+        auto [items, item_proj] = impl::contiguous_source(iter);
+        impl::composed_projection<TProj, decltype(item_proj)> key_of{ proj, item_proj };
+        if (const auto range = impl::minmax_kernel<nan_policy::skip>(items, key_of)) {
+            using unsigned_t = std::make_unsigned_t<key_t>;
+            const auto [lo, hi] = *range;
+            const auto base = static_cast<unsigned_t>(lo);
+            const auto span = static_cast<unsigned_t>(static_cast<unsigned_t>(hi) - base);
+            if (span < impl::dense_count_limit) {
+                interleaved_counts counts{ std::size_t(span) + 1 };
+                counts.add_all(items, [&](auto& item) {
+                    return static_cast<std::size_t>(static_cast<unsigned_t>(static_cast<unsigned_t>(key_of(item)) - base));
+                });
+                iter.advance(items.size());
+                return impl::dense_value_counts<key_t>(std::move(counts).result(), [&](std::size_t i) {
+                    return static_cast<key_t>(static_cast<unsigned_t>(base + i));
+                });
+            }
+        }
+        return iter.group_by(proj).aggregate(kissra::agg::count);
+    } else {
+        return iter.group_by(proj).aggregate(kissra::agg::count);
+    }
+}
+} // namespace impl
+
+template <typename Tag>
+struct histogram_mixin {
+    /**
+     * Number of items per key, ordered by the first occurrence of a key (or ascending for integral keys of a small range:
+     * 8/16-bit keys, contiguous items spanning less than 2^16 values). Those are counted within dense arrays, the rest
+     * within a `flat_hash_map` (same as `group_by(proj).aggregate(agg::count)`).
+     */
+    template <kissra::mut TSelf, typename TProj = std::identity>
+        requires kissra::regular_invocable<TProj, iter_reference_t<TSelf>&>
+    [[nodiscard]] constexpr auto value_counts(this TSelf&& self, TProj proj = {}) {
+        return impl::value_counts(self, proj);
+    }
+
+    /**
+     * Number of arithmetic items within each of `bins` equal-width bins of `[lo, hi]` (the last bin includes `hi`), the
+     * rest of the items (NaNs included) is not counted. Throws `std::invalid_argument` if `bins` is zero.
+     */
+    template <kissra::mut TSelf>
+        requires std::is_arithmetic_v<iter_value_t<TSelf>>
+    [[nodiscard]] constexpr std::vector<std::size_t> histogram(this TSelf&& self, std::size_t bins, double lo, double hi) {
+        return impl::histogram(self, bins, lo, hi);
+    }
+
+    /* Same as above over the `[min, max]` range of the items (found by an extra pass over them). */
+    template <kissra::mut TSelf>
+        requires kissra::forward_iterator<TSelf> && std::is_arithmetic_v<iter_value_t<TSelf>>
+    [[nodiscard]] constexpr std::vector<std::size_t> histogram(this TSelf&& self, std::size_t bins) {
+        auto copy = self;
+        const auto range = impl::minmax<nan_policy::skip>(copy);
+        return impl::histogram(self, bins, range ? double(range->first) : 0.0, range ? double(range->second) : 0.0);
+    }
+};
+} // namespace kissra
@@ -0,0 +1,311 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/misc/optional.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+/* How `min`/`max`/`minmax`/`argmin`/... treat floating-point NaNs. */
+enum class nan_policy {
+    /* NaNs are ignored (like `std::fmin`/`std::fmax` do), nothing but NaNs yields an empty result. */
+    skip,
+    /* The first NaN is the result. */
+    propagate,
+};
+
+namespace impl {
+template <typename T>
+constexpr bool is_nan(const T& x) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return x != x;
+    } else {
+        return false;
+    }
+}
+
+/**
+ * Arg-extremum of contiguous arithmetic items: `Lanes` independent (value, index) accumulators turn the loop body into
+ * branch-free selects per lane (auto-vectorized into min/max/blend instructions). Ties resolve to the first occurrence.
+ */
+template <nan_policy Policy, typename U, typename TProj, typename TBefore>
+constexpr auto arg_extremum_kernel(std::span<U> items, TProj& proj, TBefore before) {
+    using key_t = std::remove_cvref_t<decltype(kissra::invoke(proj, items[0]))>;
+    using result_t = kissra::optional<std::pair<key_t, std::size_t>>;
+    constexpr std::size_t lanes = 8;
+    constexpr std::size_t none = std::size_t(-1);
+
+    const std::size_t size = items.size();
+    if (size == 0) {
+        return result_t{};
+    }
+
+    /* Lanes are seeded with the first items (repeated if there are less than `Lanes` of them). */
+    const std::size_t head = std::min(size, lanes);
+    key_t acc[lanes];
+    std::size_t idx[lanes];
+    std::size_t nan_idx[lanes];
+    for (std::size_t l = 0; l != lanes; ++l) {
+        idx[l] = l % head;
+        acc[l] = kissra::invoke(proj, items[idx[l]]);
+        nan_idx[l] = impl::is_nan(acc[l]) ? idx[l] : none;
+    }
+
+    const auto step = [&](std::size_t l, std::size_t i) {
+        const key_t value = kissra::invoke(proj, items[i]);
+        bool better = before(value, acc[l]);
+        if constexpr (std::is_floating_point_v<key_t>) {
+            /* A NaN accumulator (seeded by the first items) gives way to anything. */
+            better |= impl::is_nan(acc[l]);
+            if constexpr (Policy == nan_policy::propagate) {
+                nan_idx[l] = std::min(nan_idx[l], impl::is_nan(value) ? i : none);
+            }
+        }
+        acc[l] = better ? value : acc[l];
+        idx[l] = better ? i : idx[l];
+    };
+
+    std::size_t i = head;
+    for (; i + lanes <= size; i += lanes) {
+        for (std::size_t l = 0; l != lanes; ++l) {
+            step(l, i + l);
+        }
+    }
+    for (; i != size; ++i) {
+        step(i % lanes, i);
+    }
+
+    if constexpr (std::is_floating_point_v<key_t> && Policy == nan_policy::propagate) {
+        const auto first_nan = *std::ranges::min_element(nan_idx);
+        if (first_nan != none) {
+            return result_t{ std::pair{ key_t(kissra::invoke(proj, items[first_nan])), first_nan } };
+        }
+    }
+
+    std::size_t best = none;
+    for (std::size_t l = 0; l != lanes; ++l) {
+        if (impl::is_nan(acc[l])) {
+            continue;
+        }
+        if (best == none || before(acc[l], acc[best]) || (!before(acc[best], acc[l]) && idx[l] < idx[best])) {
+            best = l;
+        }
+    }
+    if (best == none) {
+        return result_t{};
+    }
+    return result_t{ std::pair{ acc[best], idx[best] } };
+}
+
+/* Both extrema of contiguous arithmetic items in a single pass (same multi-accumulator scheme as above). */
+template <nan_policy Policy, typename U, typename TProj>
+constexpr auto minmax_kernel(std::span<U> items, TProj& proj) {
+    using key_t = std::remove_cvref_t<decltype(kissra::invoke(proj, items[0]))>;
+    using result_t = kissra::optional<std::pair<key_t, key_t>>;
+    constexpr std::size_t lanes = 8;
+
+    const std::size_t size = items.size();
+    if (size == 0) {
+        return result_t{};
+    }
+
+    const std::size_t head = std::min(size, lanes);
+    key_t lo[lanes];
+    key_t hi[lanes];
+    bool has_nan[lanes];
+    for (std::size_t l = 0; l != lanes; ++l) {
+        lo[l] = hi[l] = kissra::invoke(proj, items[l % head]);
+        has_nan[l] = impl::is_nan(lo[l]);
+    }
+
+    const auto step = [&](std::size_t l, std::size_t i) {
+        const key_t value = kissra::invoke(proj, items[i]);
+        if constexpr (std::is_floating_point_v<key_t>) {
+            lo[l] = (value < lo[l] || impl::is_nan(lo[l])) ? value : lo[l];
+            hi[l] = (hi[l] < value || impl::is_nan(hi[l])) ? value : hi[l];
+            has_nan[l] |= impl::is_nan(value);
+        } else {
+            lo[l] = value < lo[l] ? value : lo[l];
+            hi[l] = hi[l] < value ? value : hi[l];
+        }
+    };
+
+    std::size_t i = head;
+    for (; i + lanes <= size; i += lanes) {
+        for (std::size_t l = 0; l != lanes; ++l) {
+            step(l, i + l);
+        }
+    }
+    for (; i != size; ++i) {
+        step(i % lanes, i);
+    }
+
+    if constexpr (std::is_floating_point_v<key_t> && Policy == nan_policy::propagate) {
+        if (std::ranges::any_of(has_nan, std::identity{})) {
+            const auto first_nan = std::ranges::find_if(items, [&](auto& item) {
+                return impl::is_nan(key_t(kissra::invoke(proj, item)));
+            });
+            const key_t nan = kissra::invoke(proj, *first_nan);
+            return result_t{ std::pair{ nan, nan } };
+        }
+    }
+
+    result_t result;
+    for (std::size_t l = 0; l != lanes; ++l) {
+        if (impl::is_nan(lo[l])) {
+            continue;
+        }
+        if (!result) {
+            result.emplace(lo[l], hi[l]);
+        } else {
+            result->first = lo[l] < result->first ? lo[l] : result->first;
+            result->second = result->second < hi[l] ? hi[l] : result->second;
+        }
+    }
+    return result;
+}
+
+/* (Item, index) of the first item whose `proj`-ected key goes `before` every other key. */
+template <nan_policy Policy, typename TIter, typename TProj, typename TBefore>
+constexpr auto arg_extremum(TIter& iter, TProj proj, TBefore before) {
+    using val_t = kissra::iter_value_t<TIter>;
+    using ref_t = kissra::iter_reference_t<TIter>;
+
+    if constexpr (impl::contiguous_arithmetic_source<TIter> && std::same_as<TProj, std::identity>) {
+        auto [items, item_proj] = impl::contiguous_source(iter);
+        auto result = impl::arg_extremum_kernel<Policy>(items, item_proj, before);
+        iter.advance(items.size());
+        return result;
+    } else {
+        using key_t = std::remove_cvref_t<decltype(kissra::invoke(proj, std::declval<ref_t&>()))>;
+        /* The key of the best item is kept aside (unless it is the item itself), so `proj` runs once per item. */
+        constexpr bool keep_key = !std::same_as<TProj, std::identity>;
+
+        kissra::optional<std::pair<val_t, std::size_t>> best;
+        [[maybe_unused]] std::conditional_t<keep_key, kissra::optional<key_t>, std::nullptr_t> best_key{};
+        for (std::size_t i = 0; auto item = iter.next(); ++i) {
+            auto&& key = kissra::invoke(proj, *item);
+            if (impl::is_nan(key)) {
+                if constexpr (Policy == nan_policy::propagate) {
+                    best.emplace(std::forward_like<ref_t>(*item), i);
+                    break;
+                } else {
+                    continue;
+                }
+            }
+            if constexpr (keep_key) {
+                if (!best || before(key, *best_key)) {
+                    best_key.emplace(std::forward<decltype(key)>(key));
+                    best.emplace(std::forward_like<ref_t>(*item), i);
+                }
+            } else if (!best || before(key, best->first)) {
+                best.emplace(std::forward_like<ref_t>(*item), i);
+            }
+        }
+        return best;
+    }
+}
+
+template <nan_policy Policy, typename TIter>
+constexpr auto minmax(TIter& iter) {
+    using val_t = kissra::iter_value_t<TIter>;
+    using ref_t = kissra::iter_reference_t<TIter>;
+
+    if constexpr (impl::contiguous_arithmetic_source<TIter>) {
+        auto [items, item_proj] = impl::contiguous_source(iter);
+        auto result = impl::minmax_kernel<Policy>(items, item_proj);
+        iter.advance(items.size());
+        return result;
+    } else {
+        kissra::optional<std::pair<val_t, val_t>> result;
+        while (auto item = iter.next()) {
+            if (impl::is_nan(*item)) {
+                if constexpr (Policy == nan_policy::propagate) {
+                    result.emplace(*item, *item);
+                    break;
+                } else {
+                    continue;
+                }
+            }
+            if (!result) {
+                result.emplace(*item, std::forward_like<ref_t>(*item));
+            } else if (*item < result->first) {
+                result->first = std::forward_like<ref_t>(*item);
+            } else if (result->second < *item) {
+                result->second = std::forward_like<ref_t>(*item);
+            }
+        }
+        return result;
+    }
+}
+
+template <typename T>
+constexpr auto first_of(kissra::optional<T>&& pair) {
+    using first_t = decltype(pair->first);
+    return pair ? kissra::optional<first_t>{ std::move(pair->first) } : kissra::optional<first_t>{};
+}
+
+template <typename T>
+constexpr auto second_of(kissra::optional<T>&& pair) {
+    using second_t = decltype(pair->second);
+    return pair ? kissra::optional<second_t>{ std::move(pair->second) } : kissra::optional<second_t>{};
+}
+} // namespace impl
+
+template <typename Tag>
+struct minmax_mixin {
+    template <nan_policy Policy = nan_policy::skip, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto min(this TSelf&& self) {
+        return impl::first_of(impl::arg_extremum<Policy>(self, std::identity{}, std::ranges::less{}));
+    }
+
+    template <nan_policy Policy = nan_policy::skip, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto max(this TSelf&& self) {
+        return impl::first_of(impl::arg_extremum<Policy>(self, std::identity{}, std::ranges::greater{}));
+    }
+
+    /* Both the least and the greatest items (`first` and `second` respectively) in a single pass. */
+    template <nan_policy Policy = nan_policy::skip, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto minmax(this TSelf&& self) {
+        return impl::minmax<Policy>(self);
+    }
+
+    /* The (first) item with the least `proj`-ected key. */
+    template <nan_policy Policy = nan_policy::skip, kissra::mut TSelf, typename TProj>
+        requires kissra::regular_invocable<TProj, iter_reference_t<TSelf>&>
+    [[nodiscard]] constexpr auto min_by(this TSelf&& self, TProj proj) {
+        return impl::first_of(impl::arg_extremum<Policy>(self, proj, std::ranges::less{}));
+    }
+
+    /* The (first) item with the greatest `proj`-ected key. */
+    template <nan_policy Policy = nan_policy::skip, kissra::mut TSelf, typename TProj>
+        requires kissra::regular_invocable<TProj, iter_reference_t<TSelf>&>
+    [[nodiscard]] constexpr auto max_by(this TSelf&& self, TProj proj) {
+        return impl::first_of(impl::arg_extremum<Policy>(self, proj, std::ranges::greater{}));
+    }
+
+    /* Position (counting from the current front) of the first least item. */
+    template <nan_policy Policy = nan_policy::skip, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto argmin(this TSelf&& self) {
+        return impl::second_of(impl::arg_extremum<Policy>(self, std::identity{}, std::ranges::less{}));
+    }
+
+    /* Position (counting from the current front) of the first greatest item. */
+    template <nan_policy Policy = nan_policy::skip, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto argmax(this TSelf&& self) {
+        return impl::second_of(impl::arg_extremum<Policy>(self, std::identity{}, std::ranges::greater{}));
+    }
+};
+} // namespace kissra
\ No newline at end of file
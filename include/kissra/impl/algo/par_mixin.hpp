@@ -0,0 +1,274 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/algo/minmax_mixin.hpp"
+#include "kissra/impl/algo/split_at_mixin.hpp"
+#include "kissra/impl/algo/sum_mixin.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/impl/into_iter.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/misc/optional.hpp"
+#include "kissra/misc/thread_pool.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/**
+ * Pipelines `par()` can cut into independent pieces: either position splittable ones (a random access source under per
+ * item adaptors, see `is_position_splittable`) or sized splittable ones (`chunk(n)`, `take(n)`, ... over those).
+ */
+template <typename TIter>
+concept par_iterator = kissra::iterator<TIter> && std::copy_constructible<std::remove_cvref_t<TIter>> &&
+                       (is_position_splittable<std::remove_cvref_t<TIter>>::value ||
+                           (kissra::sized_iterator<TIter> && kissra::splittable_iterator<TIter>));
+
+/* Pieces never get smaller than that (in underlying positions): handing one out costs a few thousand plain iterations. */
+inline constexpr std::size_t par_min_chunk = 1uz << 12;
+
+/**
+ * Upper bound of the number of pieces: plenty to balance the load across many cores (pieces are handed out
+ * dynamically). It does NOT depend on the number of threads, so piece boundaries (and results) are the same anywhere.
+ */
+inline constexpr std::size_t par_max_chunks = 256;
+
+constexpr std::size_t par_chunk_count(std::size_t positions) {
+    return std::clamp(positions / impl::par_min_chunk, 1uz, impl::par_max_chunks);
+}
+
+/* Positions are underlying ones for position splittable iterators, items otherwise. */
+template <typename TIter>
+constexpr std::size_t par_positions(const TIter& iter) {
+    if constexpr (is_position_splittable<TIter>::value) {
+        return impl::remaining_positions(iter);
+    } else {
+        return iter.size();
+    }
+}
+
+template <typename TIter>
+constexpr TIter par_slice(const TIter& iter, std::size_t first, std::size_t last) {
+    if constexpr (is_position_splittable<TIter>::value) {
+        return impl::slice_positions(iter, first, last);
+    } else {
+        TIter piece = iter;
+        piece.advance(first);
+        return std::move(piece).split_at(last - first).first;
+    }
+}
+
+/**
+ * `par()` terminals: the positions are cut into pieces (`par_chunk_count`), every piece is evaluated by its own
+ * copy of the pipeline on `thread_pool`, and the per-piece results are combined in the source order. Adaptor
+ * functors are invoked concurrently, hence must not mutate shared state.
+ */
+template <typename TIter>
+class par_executor {
+public:
+    constexpr par_executor(TIter&& iter, thread_pool& pool)
+        : iter(std::forward<TIter>(iter))
+        , pool(pool) {
+        /* Fast-forward lazily dropped items (e.g. `drop_while`) once rather than within every piece. */
+        this->iter.advance(0);
+    }
+
+    /* `identity` has to be a neutral element of `op`, `op` has to be associative (both `acc op item` and `acc op acc`). */
+    template <typename T, typename TOp>
+    [[nodiscard]] auto reduce(T identity, TOp op) {
+        using acc_t = std::remove_cvref_t<T>;
+        auto partials = this->map_chunks([&](iter_t& slice) {
+            acc_t acc = identity;
+            while (auto item = slice.next()) {
+                acc = std::invoke(op, std::move(acc), std::forward_like<iter_reference_t<iter_t>>(*item));
+            }
+            return acc;
+        });
+        acc_t result = std::move(identity);
+        for (auto& partial : partials) {
+            result = std::invoke(op, std::move(result), std::move(*partial));
+        }
+        return result;
+    }
+
+    /* Per piece `sum<TAcc, Summation>()`, the partial sums are added up left to right. */
+    template <typename TAcc = void, summation Summation = summation::fast>
+    [[nodiscard]] auto sum() {
+        using acc_t = std::conditional_t<std::is_void_v<TAcc>, impl::default_sum_t<iter_value_t<iter_t>>, TAcc>;
+        auto partials = this->map_chunks([](iter_t& slice) { return slice.template sum<acc_t, Summation>(); });
+        acc_t result{};
+        for (auto& partial : partials) {
+            result += *partial;
+        }
+        return result;
+    }
+
+    template <summation Summation, typename TAcc = void>
+    [[nodiscard]] auto sum() {
+        return this->template sum<TAcc, Summation>();
+    }
+
+    [[nodiscard]] std::size_t count() {
+        if constexpr (kissra::is_sized_v<iter_t>) {
+            return this->iter.size();
+        } else {
+            auto partials = this->map_chunks([](iter_t& slice) { return slice.count(); });
+            std::size_t result = 0;
+            for (const auto& partial : partials) {
+                result += *partial;
+            }
+            return result;
+        }
+    }
+
+    template <typename TFn>
+        requires kissra::regular_invocable<TFn, iter_reference_t<iter_t>>
+    [[nodiscard]] std::size_t count_if(TFn pred) {
+        auto partials = this->map_chunks([&](iter_t& slice) { return slice.count_if(pred); });
+        std::size_t result = 0;
+        for (const auto& partial : partials) {
+            result += *partial;
+        }
+        return result;
+    }
+
+    template <nan_policy Policy = nan_policy::skip>
+    [[nodiscard]] auto min() {
+        return this->extremum([](iter_t& slice) { return slice.template min<Policy>(); }, std::ranges::less{});
+    }
+
+    template <nan_policy Policy = nan_policy::skip>
+    [[nodiscard]] auto max() {
+        return this->extremum([](iter_t& slice) { return slice.template max<Policy>(); }, std::ranges::greater{});
+    }
+
+    /* `fn(item)` for every item, in no particular order. */
+    template <typename TFn>
+        requires kissra::regular_invocable<TFn, iter_reference_t<iter_t>>
+    void for_each(TFn fn) {
+        this->run_chunks([&](std::size_t, std::size_t, iter_t& slice) {
+            while (auto item = slice.next()) {
+                kissra::invoke(fn, std::forward_like<iter_reference_t<iter_t>>(*item));
+            }
+        });
+    }
+
+    /**
+     * Items in the source order. Sized pipelines write every piece straight into its part of the preallocated result.
+     * Otherwise every piece collects into its own buffer, and the buffers are moved into the result (in parallel as
+     * well) at the offsets given by a prefix sum of their sizes.
+     */
+    template <template <typename...> typename TTo = std::vector>
+    [[nodiscard]] auto collect() {
+        using val_t = iter_value_t<iter_t>;
+        using container_t = TTo<val_t>;
+        /* Contiguous containers of default constructible items can be resized upfront and then written concurrently. */
+        constexpr bool resizable = std::ranges::contiguous_range<container_t> && std::is_default_constructible_v<val_t> &&
+                                   requires(container_t& result) { result.resize(0uz); };
+
+        container_t result;
+        if constexpr (kissra::is_sized_v<iter_t> && resizable) {
+            result.resize(this->iter.size());
+            const std::span out{ result };
+            this->run_chunks([&](std::size_t, std::size_t first, iter_t& slice) {
+                (void)slice.write_into(out.subspan(first, slice.size()));
+            });
+        } else {
+            auto buffers = this->map_chunks([](iter_t& slice) { return slice.collect(); });
+            std::vector<std::size_t> offsets(buffers.size() + 1);
+            for (std::size_t i = 0; i != buffers.size(); ++i) {
+                offsets[i + 1] = offsets[i] + buffers[i]->size();
+            }
+
+            if constexpr (resizable) {
+                result.resize(offsets.back());
+                const std::span out{ result };
+                this->pool.run(buffers.size(), [&](std::size_t chunk) {
+                    std::ranges::move(*buffers[chunk], out.begin() + offsets[chunk]);
+                });
+            } else {
+                if constexpr (kissra::can_reserve<container_t>) {
+                    result.reserve(offsets.back());
+                }
+                for (auto& buffer : buffers) {
+                    result.insert(std::ranges::end(result), std::make_move_iterator(buffer->begin()), std::make_move_iterator(buffer->end()));
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+    using iter_t = std::remove_cvref_t<TIter>;
+
+    /* `fn(chunk, first, slice)` per piece, `first` is the position the piece starts at. */
+    template <typename TFn>
+    void run_chunks(TFn fn) {
+        const std::size_t positions = impl::par_positions(this->iter);
+        const std::size_t chunks = impl::par_chunk_count(positions);
+        this->pool.run(chunks, [&](std::size_t chunk) {
+            const std::size_t first = positions * chunk / chunks;
+            auto slice = impl::par_slice(this->iter, first, positions * (chunk + 1) / chunks);
+            fn(chunk, first, slice);
+        });
+    }
+
+    /* `fn(slice)` per piece, results in the source order. */
+    template <typename TFn>
+    auto map_chunks(TFn fn) {
+        using result_t = std::invoke_result_t<TFn&, iter_t&>;
+        std::vector<kissra::optional<result_t>> partials(
+            impl::par_chunk_count(impl::par_positions(this->iter)));
+        this->run_chunks([&](std::size_t chunk, std::size_t, iter_t& slice) { partials[chunk].emplace(fn(slice)); });
+        return partials;
+    }
+
+    /* The first of the per piece extrema (a NaN one included, those are there with `nan_policy::propagate` only). */
+    template <typename TFn, typename TBefore>
+    auto extremum(TFn fn, TBefore before) {
+        auto partials = this->map_chunks(fn);
+        std::invoke_result_t<TFn&, iter_t&> result;
+        for (auto& partial : partials) {
+            if (*partial && (!result || (!impl::is_nan(*result) && (impl::is_nan(**partial) || before(**partial, *result))))) {
+                result = std::move(*partial);
+            }
+        }
+        return result;
+    }
+
+    TIter iter;
+    thread_pool& pool;
+};
+} // namespace impl
+
+template <typename Tag>
+struct par_mixin {
+    /**
+     * Parallel terminals (`par().sum()`, `par().count_if(pred)`, `par().reduce(identity, op)`, `par().for_each(fn)`,
+     * ...) over a random access source under per item adaptors (or sized splittable pipelines over one), see
+     * `impl::par_executor`. The pieces are fixed by the size only, hence results are deterministic (bitwise,
+     * floating-point sums included).
+     */
+    template <kissra::mut TSelf>
+        requires impl::par_iterator<TSelf>
+    [[nodiscard]] constexpr auto par(this TSelf&& self, thread_pool& pool = thread_pool::shared()) {
+        return impl::par_executor<TSelf>{ std::forward<TSelf>(self), pool };
+    }
+};
+
+template <kissra::iterator_compatible T, typename DeferInstantiation = void>
+[[nodiscard]] constexpr auto par(T&& rng_or_kissra_iter, thread_pool& pool = thread_pool::shared()) {
+    return impl::into_kissra_iter<DeferInstantiation>(KISSRA_FWD(rng_or_kissra_iter)).par(pool);
+}
+} // namespace kissra
@@ -0,0 +1,161 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/algo/collect_mixin.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/misc/utility.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/* Items worth staging: cheap to copy around and small enough for (at least) 2 of them to share a cache line. */
+template <typename T>
+concept write_combinable = std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T> &&
+                           sizeof(T) * 2 <= impl::cache_line_size;
+
+template <typename TContainer, typename T>
+concept can_append_block = requires(TContainer container, const T* ptr) {
+    container.insert(std::ranges::end(container), ptr, ptr);
+};
+
+template <typename TContainer>
+concept can_resize_contiguous = std::ranges::contiguous_range<TContainer> && requires(TContainer container) {
+    container.resize(1uz);
+};
+
+/**
+ * Software write-combining: every partition gets a cache line sized staging block, a full block is appended to its
+ * output at once. With hundreds of partitions this keeps the working set of scattered stores within L1 (and the TLB)
+ * instead of touching a distinct output page per item.
+ */
+template <write_combinable T>
+class write_combining_buffers {
+public:
+    static constexpr std::size_t block_capacity = impl::cache_line_size / sizeof(T);
+
+    constexpr explicit write_combining_buffers(std::size_t k)
+        : blocks(k)
+        , sizes(k) {}
+
+    /* Returns `true` once the block of the partition `i` is full and has to be flushed. */
+    constexpr bool push(std::size_t i, const T& item) {
+        this->blocks[i].items[this->sizes[i]] = item;
+        return ++this->sizes[i] == block_capacity;
+    }
+
+    template <typename TContainer>
+    constexpr void flush(std::size_t i, TContainer& out) {
+        const T* first = this->blocks[i].items;
+        out.insert(std::ranges::end(out), first, first + this->sizes[i]);
+        this->sizes[i] = 0;
+    }
+
+private:
+    struct alignas(impl::cache_line_size) block {
+        T items[block_capacity];
+    };
+
+    std::vector<block> blocks;
+    std::vector<std::uint8_t> sizes;
+};
+} // namespace impl
+
+template <typename Tag>
+struct partition_mixin {
+    /**
+     * Scatter items into `k` containers in a single pass: an item goes into the container number `key_fn(item)`
+     * (which must be within `[0, k)`). Relative order of items within every container is preserved.
+     */
+    template <template <typename...> typename TTo = std::vector, kissra::mut TSelf, typename TFn>
+        requires kissra::regular_invocable<TFn, iter_reference_t<TSelf>&>
+    [[nodiscard]] constexpr auto partition_into(this TSelf&& self, std::size_t k, TFn key_fn) {
+        using val_t = kissra::iter_value_t<TSelf>;
+        using ref_t = kissra::iter_reference_t<TSelf>;
+        using container_t = TTo<val_t>;
+
+        std::vector<container_t> result(k);
+        if constexpr (kissra::is_sized_v<TSelf> && kissra::can_reserve<container_t>) {
+            if (k != 0) {
+                for (auto& container : result) {
+                    container.reserve(self.size() / k);
+                }
+            }
+        }
+
+        if constexpr (impl::write_combinable<val_t> && impl::can_append_block<container_t, val_t>) {
+            impl::write_combining_buffers<val_t> staging(k);
+            while (auto item = self.next()) {
+                const auto key = static_cast<std::size_t>(kissra::invoke(key_fn, *item));
+                if (staging.push(key, *item)) {
+                    staging.flush(key, result[key]);
+                }
+            }
+            for (std::size_t i = 0; i != k; ++i) {
+                staging.flush(i, result[i]);
+            }
+        } else {
+            while (auto item = self.next()) {
+                const auto key = static_cast<std::size_t>(kissra::invoke(key_fn, *item));
+                impl::push_item(result[key], std::forward_like<ref_t>(*item));
+            }
+        }
+
+        return result;
+    }
+
+    /* Split items into those which satisfy `pred` (`first`) and the rest (`second`) preserving their relative order. */
+    template <template <typename...> typename TTo = std::vector, kissra::mut TSelf, typename TFn>
+        requires kissra::regular_invocable<TFn, iter_reference_t<TSelf>&>
+    [[nodiscard]] constexpr auto partition(this TSelf&& self, TFn pred) {
+        using val_t = kissra::iter_value_t<TSelf>;
+        using ref_t = kissra::iter_reference_t<TSelf>;
+        using container_t = TTo<val_t>;
+
+        std::pair<container_t, container_t> result;
+        if constexpr (kissra::is_sized_v<TSelf> && std::is_trivially_copyable_v<val_t> &&
+                      std::is_default_constructible_v<val_t> && impl::can_resize_contiguous<container_t>) {
+            /**
+             * Branchless over a single buffer of `size()` items: every item is written both right after the matching
+             * ones (growing from the front) and right before the rest (growing from the back, in reverse), only the
+             * count of the side it belongs to is bumped. The rest is copied out into `second` afterwards, hence the
+             * peak memory is `size() + second.size()` items and `first` keeps the capacity of `size()` items.
+             */
+            const auto size = self.size();
+            result.first.resize(size);
+
+            auto* items = std::ranges::data(result.first);
+            std::size_t selected_size = 0;
+            std::size_t rejected_size = 0;
+            while (auto item = self.next()) {
+                const bool matches = static_cast<bool>(kissra::invoke(pred, *item));
+                items[selected_size] = *item;
+                items[size - 1 - rejected_size] = *item;
+                selected_size += matches;
+                rejected_size += !matches;
+            }
+
+            result.second.resize(rejected_size);
+            std::ranges::reverse_copy(items + (size - rejected_size), items + size, std::ranges::data(result.second));
+            result.first.resize(selected_size);
+        } else {
+            while (auto item = self.next()) {
+                auto& out = kissra::invoke(pred, *item) ? result.first : result.second;
+                impl::push_item(out, std::forward_like<ref_t>(*item));
+            }
+        }
+
+        return result;
+    }
+};
+} // namespace kissra
\ No newline at end of file
@@ -0,0 +1,247 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/algo/minmax_mixin.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/misc/optional.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+/* How `quantile(q)` (`median()`, `quantiles(...)`) maps `q` onto the items. */
+enum class quantile_method {
+    /* Linear interpolation between the two closest ranks, `h = (n - 1) * q` (NumPy's default). Arithmetic items only. */
+    linear,
+    /* The item of rank `ceil(q * n) - 1` (nearest-rank method): an actual item, any totally ordered type. */
+    exact,
+};
+
+namespace impl {
+/* Ranges shorter than that are selected within by the plain partitioning loop (sampling doesn't pay off). */
+inline constexpr std::size_t floyd_rivest_cutoff = 600;
+
+/**
+ * Put the item of rank `k` (w.r.t. `less`) of `items[left..right]` to `items[k]`, lesser ones before and greater ones
+ * after it. Floyd-Rivest: the range is first narrowed down by a recursive selection within a small sample around the
+ * expected position, so that the pivot is very close to the `k`-th item (~`n + min(k, n - k)` comparisons on average).
+ * Falls back to `std::nth_element` (introselect) if partitioning doesn't converge fast enough.
+ */
+template <typename T, typename TLess>
+constexpr void floyd_rivest_select(std::span<T> items, std::size_t left, std::size_t right, std::size_t k, TLess& less) {
+    std::size_t budget = 2 * std::bit_width(right - left + 1) + 8;
+    while (right > left) {
+        if (budget-- == 0) {
+            std::nth_element(items.begin() + left, items.begin() + k, items.begin() + right + 1, less);
+            return;
+        }
+        if (right - left > impl::floyd_rivest_cutoff) {
+            const double n = double(right - left + 1);
+            const double i = double(k - left + 1);
+            const double z = std::log(n);
+            const double s = 0.5 * std::exp(2.0 * z / 3.0);
+            const double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2 ? -1.0 : 1.0);
+            const double sample_left = std::floor(double(k) - i * s / n + sd);
+            const double sample_right = std::floor(double(k) + (n - i) * s / n + sd);
+            impl::floyd_rivest_select(items,
+                std::max(left, sample_left > 0 ? std::size_t(sample_left) : 0),
+                std::min(right, std::size_t(sample_right)),
+                k,
+                less);
+        }
+
+        /* Partition around `t = items[k]` (moved to one of the ends so that both scans have a sentinel). */
+        using std::swap;
+        const T t = items[k];
+        std::size_t i = left;
+        std::size_t j = right;
+        swap(items[left], items[k]);
+        if (less(t, items[right])) {
+            swap(items[right], items[left]);
+        }
+        while (i < j) {
+            swap(items[i], items[j]);
+            ++i;
+            --j;
+            while (less(items[i], t)) {
+                ++i;
+            }
+            while (less(t, items[j])) {
+                --j;
+            }
+        }
+        if (!less(items[left], t) && !less(t, items[left])) {
+            swap(items[left], items[j]);
+        } else {
+            ++j;
+            swap(items[j], items[right]);
+        }
+
+        if (j <= k) {
+            left = j + 1;
+        }
+        if (k <= j) {
+            if (j == 0) {
+                return;
+            }
+            right = j - 1;
+        }
+    }
+}
+
+/**
+ * Put every item of the (sorted, unique) `ranks` within `items` into its sorted position in one go: select the middle
+ * rank, then recurse into the parts before and after it with the ranks which belong there (O(n log(ranks)) overall).
+ */
+template <typename T, typename TLess>
+constexpr void multiselect(std::span<T> items, std::span<const std::size_t> ranks, std::size_t offset, TLess& less) {
+    if (ranks.empty() || items.size() <= 1) {
+        return;
+    }
+    const std::size_t mid = ranks.size() / 2;
+    const std::size_t k = ranks[mid] - offset;
+    impl::floyd_rivest_select(items, 0, items.size() - 1, k, less);
+    impl::multiselect(items.first(k), ranks.first(mid), offset, less);
+    impl::multiselect(items.subspan(k + 1), ranks.subspan(mid + 1), offset + k + 1, less);
+}
+
+template <typename T>
+using quantile_value_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+template <quantile_method Method, typename T>
+using quantile_result_t = std::conditional_t<Method == quantile_method::linear, quantile_value_t<T>, T>;
+
+/* Copy of the (remaining) items to select within, NaNs are dropped (those are not ordered). */
+template <typename TIter>
+constexpr auto scratch_buffer(TIter& iter) {
+    auto items = iter.collect();
+    if constexpr (std::is_floating_point_v<kissra::iter_value_t<TIter>>) {
+        std::erase_if(items, [](const auto& item) { return impl::is_nan(item); });
+    }
+    return items;
+}
+
+/* Rank of the `exact` quantile `q` among `n` items. */
+constexpr std::size_t nearest_rank(double q, std::size_t n) {
+    const auto rank = static_cast<std::size_t>(std::ceil(q * double(n)));
+    return rank == 0 ? 0 : std::min(rank, n) - 1;
+}
+
+/* Quantiles `qs` of `items` (reordered), `out(i, value)` receives the quantile `qs[i]`. */
+template <quantile_method Method, typename T, typename TOut>
+constexpr void quantiles(std::vector<T>& items, std::span<const double> qs, TOut out) {
+    const std::size_t n = items.size();
+    std::vector<std::size_t> ranks;
+    ranks.reserve(2 * qs.size());
+    for (const double q : qs) {
+        if (!(q >= 0.0 && q <= 1.0)) {
+            throw std::invalid_argument("kissra::quantile: q is out of [0, 1]");
+        }
+        if constexpr (Method == quantile_method::linear) {
+            const auto lo = static_cast<std::size_t>(double(n - 1) * q);
+            ranks.push_back(lo);
+            ranks.push_back(std::min(lo + 1, n - 1));
+        } else {
+            ranks.push_back(impl::nearest_rank(q, n));
+        }
+    }
+    std::ranges::sort(ranks);
+    ranks.erase(std::ranges::unique(ranks).begin(), ranks.end());
+
+    std::ranges::less less;
+    impl::multiselect(std::span{ items }, std::span<const std::size_t>{ ranks }, 0, less);
+
+    for (std::size_t i = 0; i != qs.size(); ++i) {
+        if constexpr (Method == quantile_method::linear) {
+            using result_t = quantile_value_t<T>;
+            const double h = double(n - 1) * qs[i];
+            const auto lo = static_cast<std::size_t>(h);
+            const auto x_lo = static_cast<result_t>(items[lo]);
+            const auto x_hi = static_cast<result_t>(items[std::min(lo + 1, n - 1)]);
+            out(i, x_lo + static_cast<result_t>(h - double(lo)) * (x_hi - x_lo));
+        } else {
+            out(i, items[impl::nearest_rank(qs[i], n)]);
+        }
+    }
+}
+} // namespace impl
+
+template <typename Tag>
+struct quantile_mixin {
+    /**
+     * Quantile `q` (within `[0, 1]`, throws `std::invalid_argument` otherwise) of the items, see `quantile_method`.
+     * Items are copied into a scratch buffer and selected within (no full sort), NaNs are ignored. Empty if there are
+     * no items.
+     */
+    template <quantile_method Method = quantile_method::linear, kissra::mut TSelf>
+        requires(Method == quantile_method::exact || std::is_arithmetic_v<iter_value_t<TSelf>>)
+    [[nodiscard]] constexpr auto quantile(this TSelf&& self, double q) {
+        using result_t = impl::quantile_result_t<Method, iter_value_t<TSelf>>;
+        if (const auto result = self.template quantiles<Method>({ q })) {
+            return kissra::optional<result_t>{ (*result)[0] };
+        }
+        return kissra::optional<result_t>{};
+    }
+
+    template <quantile_method Method = quantile_method::linear, kissra::mut TSelf>
+        requires(Method == quantile_method::exact || std::is_arithmetic_v<iter_value_t<TSelf>>)
+    [[nodiscard]] constexpr auto median(this TSelf&& self) {
+        return self.template quantile<Method>(0.5);
+    }
+
+    /**
+     * Several quantiles at once (e.g. `quantiles({ 0.5, 0.9, 0.99, 0.999 })`): a single selection pass which puts every
+     * required rank into its place.
+     */
+    template <quantile_method Method = quantile_method::linear, kissra::mut TSelf, std::size_t N>
+        requires(Method == quantile_method::exact || std::is_arithmetic_v<iter_value_t<TSelf>>)
+    [[nodiscard]] constexpr auto quantiles(this TSelf&& self, const double (&qs)[N]) {
+        using result_t = impl::quantile_result_t<Method, iter_value_t<TSelf>>;
+        auto items = impl::scratch_buffer(self);
+        if (items.empty()) {
+            return kissra::optional<std::array<result_t, N>>{};
+        }
+        std::array<result_t, N> result;
+        impl::quantiles<Method>(items, std::span<const double>{ qs }, [&](std::size_t i, auto value) { result[i] = value; });
+        return kissra::optional<std::array<result_t, N>>{ result };
+    }
+
+    template <quantile_method Method = quantile_method::linear, kissra::mut TSelf>
+        requires(Method == quantile_method::exact || std::is_arithmetic_v<iter_value_t<TSelf>>)
+    [[nodiscard]] constexpr auto quantiles(this TSelf&& self, std::span<const double> qs) {
+        using result_t = impl::quantile_result_t<Method, iter_value_t<TSelf>>;
+        auto items = impl::scratch_buffer(self);
+        if (items.empty()) {
+            return kissra::optional<std::vector<result_t>>{};
+        }
+        std::vector<result_t> result(qs.size());
+        impl::quantiles<Method>(items, qs, [&](std::size_t i, auto value) { result[i] = value; });
+        return kissra::optional<std::vector<result_t>>{ std::move(result) };
+    }
+
+    /* The item of rank `k` (counting from 0) w.r.t. `cmp`, as if the items were sorted. Empty if there are not enough items. */
+    template <kissra::mut TSelf, typename TCmp = std::ranges::less>
+    [[nodiscard]] constexpr auto nth_element(this TSelf&& self, std::size_t k, TCmp cmp = {}) {
+        auto items = self.collect();
+        if (k >= items.size()) {
+            return kissra::optional<iter_value_t<TSelf>>{};
+        }
+        impl::floyd_rivest_select(std::span{ items }, 0, items.size() - 1, k, cmp);
+        return kissra::optional<iter_value_t<TSelf>>{ std::move(items[k]) };
+    }
+};
+} // namespace kissra
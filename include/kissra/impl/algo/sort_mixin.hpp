@@ -0,0 +1,233 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/* Keys whose order is the order of their (adjusted) bit patterns: integers and IEEE-754 `float`s/`double`s. */
+template <typename TKey>
+concept radix_key = (std::integral<TKey> && !std::same_as<TKey, bool> && sizeof(TKey) <= 8) ||
+                    (std::floating_point<TKey> && std::numeric_limits<TKey>::is_iec559 &&
+                     (sizeof(TKey) == 4 || sizeof(TKey) == 8));
+
+/* Below that many items a comparison sort beats the histogram & scatter passes. */
+inline constexpr std::size_t radix_sort_threshold = 256;
+
+/**
+ * Unsigned bit pattern ordered the same way as `key`: the sign bit of signed integers is flipped, negative floats get
+ * all the bits flipped (positive ones the sign bit only). `-0.0` goes right before `+0.0`, NaNs go to the ends.
+ */
+template <radix_key TKey>
+constexpr auto radix_bits(TKey key) {
+    if constexpr (std::floating_point<TKey>) {
+        using bits_t = std::conditional_t<sizeof(TKey) == 4, std::uint32_t, std::uint64_t>;
+        constexpr bits_t sign = bits_t(1) << (sizeof(TKey) * 8 - 1);
+        const auto bits = std::bit_cast<bits_t>(key);
+        return bits ^ ((bits_t(0) - (bits >> (sizeof(TKey) * 8 - 1))) | sign);
+    } else {
+        using bits_t = std::make_unsigned_t<TKey>;
+        auto bits = static_cast<bits_t>(key);
+        if constexpr (std::is_signed_v<TKey>) {
+            bits ^= bits_t(bits_t(1) << (sizeof(TKey) * 8 - 1));
+        }
+        return bits;
+    }
+}
+
+template <typename T, typename TProj>
+using projected_key_t = std::remove_cvref_t<kissra::invoke_result_t<TProj&, T&>>;
+
+/**
+ * Stable LSD radix sort pass over a single key: a histogram pass counts all the (byte sized) digits at once, then
+ * every digit takes a scatter pass from one buffer into the other (digits all the items share are skipped).
+ * Returns whether the items ended up in `scratch`.
+ */
+template <typename T, typename TProj>
+constexpr bool radix_sort_by(std::span<T> items, std::span<T> scratch, bool in_scratch, TProj& proj) {
+    constexpr std::size_t digits = sizeof(impl::radix_bits(std::declval<projected_key_t<T, TProj>>()));
+    const auto bits_of = [&](T& item) {
+        return impl::radix_bits(projected_key_t<T, TProj>(kissra::invoke(proj, item)));
+    };
+
+    std::span<T> src = in_scratch ? scratch : items;
+    std::span<T> dst = in_scratch ? items : scratch;
+
+    std::array<std::array<std::size_t, 256>, digits> counts{};
+    for (T& item : src) {
+        const auto bits = bits_of(item);
+        for (std::size_t d = 0; d != digits; ++d) {
+            ++counts[d][(bits >> (d * 8)) & 0xff];
+        }
+    }
+
+    const auto first_bits = bits_of(src[0]);
+    for (std::size_t d = 0; d != digits; ++d) {
+        auto& offsets = counts[d];
+        if (offsets[(first_bits >> (d * 8)) & 0xff] == src.size()) {
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for (auto& count : offsets) {
+            offset += std::exchange(count, offset);
+        }
+        for (T& item : src) {
+            dst[offsets[(bits_of(item) >> (d * 8)) & 0xff]++] = std::move(item);
+        }
+        std::swap(src, dst);
+        in_scratch = !in_scratch;
+    }
+    return in_scratch;
+}
+
+/* Stable sort by `projs` (the first one is the most significant key): one `radix_sort_by` per key, the least significant first. */
+template <typename T, typename... TProjs>
+constexpr void radix_sort(std::span<T> items, TProjs&... projs) {
+    std::vector<T> scratch(items.size());
+    bool in_scratch = false;
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        ((in_scratch = impl::radix_sort_by(items, std::span{ scratch }, in_scratch, projs...[sizeof...(TProjs) - 1 - Is])),
+            ...);
+    }(std::index_sequence_for<TProjs...>{});
+
+    if (in_scratch) {
+        std::ranges::move(scratch, items.begin());
+    }
+}
+
+/* `l` goes before `r` if its keys (`projs` applied) are lexicographically less. */
+template <typename... TProjs>
+struct lexicographic_less {
+    template <typename T>
+    constexpr bool operator()(const T& l, const T& r) const {
+        return std::apply(
+            [&](const auto&... proj) {
+                int order = 0;
+                ((order = order != 0 ? order : lexicographic_less::compare(proj, l, r)), ...);
+                return order < 0;
+            },
+            this->projs);
+    }
+
+    std::tuple<TProjs...> projs;
+
+private:
+    template <typename TProj, typename T>
+    static constexpr int compare(const TProj& proj, const T& l, const T& r) {
+        const auto& l_key = kissra::invoke(proj, l);
+        const auto& r_key = kissra::invoke(proj, r);
+        return l_key < r_key ? -1 : (r_key < l_key ? 1 : 0);
+    }
+};
+
+template <typename TContainer, typename... TProjs>
+concept radix_sortable = std::ranges::contiguous_range<TContainer> &&
+                         std::is_default_constructible_v<std::ranges::range_value_t<TContainer>> &&
+                         std::is_move_assignable_v<std::ranges::range_value_t<TContainer>> &&
+                         (radix_key<projected_key_t<std::ranges::range_value_t<TContainer>, TProjs>> && ...);
+
+template <typename TContainer, typename TCmp>
+constexpr void comparison_sort(TContainer& items, TCmp cmp, bool stable) {
+    if constexpr (std::ranges::random_access_range<TContainer>) {
+        if (stable) {
+            std::ranges::stable_sort(items, cmp);
+        } else {
+            std::ranges::sort(items, cmp);
+        }
+    } else {
+        items.sort(cmp);
+    }
+}
+
+/* Sort w.r.t. `cmp`: radix sort for arithmetic items compared naturally, introsort (`std::sort`) otherwise. */
+template <typename TContainer, typename TCmp>
+constexpr void sort(TContainer& items, TCmp cmp) {
+    if constexpr (impl::natural_order<TCmp> && impl::radix_sortable<TContainer, std::identity>) {
+        if (std::ranges::size(items) >= impl::radix_sort_threshold) {
+            std::identity proj;
+            impl::radix_sort(std::span{ items }, proj);
+            if constexpr (impl::natural_greater<TCmp>) {
+                std::ranges::reverse(items);
+            }
+            return;
+        }
+    }
+    impl::comparison_sort(items, cmp, false);
+}
+
+/* Stable sort by the keys `projs` yield: radix sort if every key is an integer or a float, merge sort otherwise. */
+template <typename TContainer, typename... TProjs>
+constexpr void sort_by(TContainer& items, TProjs&... projs) {
+    if constexpr (impl::radix_sortable<TContainer, TProjs...>) {
+        if (std::ranges::size(items) >= impl::radix_sort_threshold) {
+            impl::radix_sort(std::span{ items }, projs...);
+            return;
+        }
+    }
+    impl::comparison_sort(items, impl::lexicographic_less<TProjs...>{ { projs... } }, true);
+}
+} // namespace impl
+
+template <typename Tag>
+struct sort_mixin {
+    /**
+     * All the items sorted w.r.t. `cmp` (ascending by default). Arithmetic items compared with `<`/`>` are radix sorted,
+     * anything else goes through `std::sort` (introsort).
+     */
+    template <template <typename...> typename TTo = std::vector, kissra::mut TSelf, typename TCmp = std::ranges::less>
+    [[nodiscard]] constexpr auto sorted(this TSelf&& self, TCmp cmp = {}) {
+        auto result = std::forward<TSelf>(self).template collect<TTo>();
+        impl::sort(result, cmp);
+        return result;
+    }
+
+    /**
+     * All the items stably sorted by the keys `projs` yield (ascending, lexicographically if there are several of them).
+     * Radix sorted if every key is an integer or a float (e.g. `sorted_by(fn::member<1>, fn::member<0>)`).
+     */
+    template <template <typename...> typename TTo = std::vector, kissra::mut TSelf, typename... TProjs>
+        requires(sizeof...(TProjs) != 0) && (kissra::regular_invocable<TProjs, iter_value_t<TSelf>&> && ...)
+    [[nodiscard]] constexpr auto sorted_by(this TSelf&& self, TProjs... projs) {
+        auto result = std::forward<TSelf>(self).template collect<TTo>();
+        impl::sort_by(result, projs...);
+        return result;
+    }
+
+    /**
+     * Replace the contents of `out` with the items sorted as `sorted()` (no `projs`) or `sorted_by(projs...)` do (the
+     * capacity of `out` is reused across calls).
+     */
+    template <kissra::mut TSelf, typename TContainer, typename... TProjs>
+        requires(kissra::regular_invocable<TProjs, std::ranges::range_value_t<TContainer>&> && ...)
+    constexpr TContainer& sort_into(this TSelf&& self, TContainer& out, TProjs... projs) {
+        self.collect_into(out);
+        if constexpr (sizeof...(TProjs) == 0) {
+            impl::sort(out, std::ranges::less{});
+        } else {
+            impl::sort_by(out, projs...);
+        }
+        return out;
+    }
+};
+} // namespace kissra
\ No newline at end of file
@@ -0,0 +1,189 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/impl/iter/all_iter.hpp"
+#include "kissra/impl/iter/cache_latest_iter.hpp"
+#include "kissra/impl/iter/drop_iter.hpp"
+#include "kissra/impl/iter/drop_last_iter.hpp"
+#include "kissra/impl/iter/drop_last_while_iter.hpp"
+#include "kissra/impl/iter/drop_while_iter.hpp"
+#include "kissra/impl/iter/filter_iter.hpp"
+#include "kissra/impl/iter/reverse_iter.hpp"
+#include "kissra/impl/iter/transform_iter.hpp"
+#include "kissra/impl/iter/zip_iter.hpp"
+#include "kissra/misc/optional.hpp"
+#include "kissra/misc/type_list.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/**
+ * Iterators which can be cut at any underlying position without evaluating a single item: a random access (common)
+ * source, possibly `zip`-ped with other such sources, under adaptors which treat every item on its own (`transform`,
+ * `filter`, `members<I>`, `keys`, ...) or only look at the ends (`drop*`, once those are fast-forwarded).
+ */
+template <typename TIter>
+struct is_position_splittable : std::false_type {};
+
+template <typename TRng, template <typename> typename... TMixins>
+struct is_position_splittable<all_iter<TRng, TMixins...>>
+    : std::bool_constant<std::ranges::random_access_range<TRng> && std::ranges::common_range<TRng>> {};
+
+template <typename TBaseIter, typename TFn, template <typename> typename... TMixins>
+struct is_position_splittable<transform_iter<TBaseIter, TFn, TMixins...>> : is_position_splittable<TBaseIter> {};
+
+template <typename TBaseIter, typename TFn, template <typename> typename... TMixins>
+struct is_position_splittable<filter_iter<TBaseIter, TFn, TMixins...>> : is_position_splittable<TBaseIter> {};
+
+template <typename TBaseIter, template <typename> typename... TMixins>
+struct is_position_splittable<cache_latest_iter<TBaseIter, TMixins...>> : is_position_splittable<TBaseIter> {};
+
+template <typename TBaseIter, template <typename> typename... TMixins>
+struct is_position_splittable<reverse_iter<TBaseIter, TMixins...>> : is_position_splittable<TBaseIter> {};
+
+template <typename TBaseIter, template <typename> typename... TMixins>
+struct is_position_splittable<drop_iter<TBaseIter, TMixins...>> : is_position_splittable<TBaseIter> {};
+
+template <typename TBaseIter, template <typename> typename... TMixins>
+struct is_position_splittable<drop_last_iter<TBaseIter, TMixins...>> : is_position_splittable<TBaseIter> {};
+
+template <typename TBaseIter, typename TFn, template <typename> typename... TMixins>
+struct is_position_splittable<drop_while_iter<TBaseIter, TFn, TMixins...>> : is_position_splittable<TBaseIter> {};
+
+template <typename TBaseIter, typename TFn, template <typename> typename... TMixins>
+struct is_position_splittable<drop_last_while_iter<TBaseIter, TFn, TMixins...>> : is_position_splittable<TBaseIter> {};
+
+template <typename TBaseIter, typename... TIters, template <typename> typename... TMixins>
+struct is_position_splittable<zip_iter<TBaseIter, tmp::type_list<TIters...>, TMixins...>>
+    : std::bool_constant<is_position_splittable<TBaseIter>::value && (is_position_splittable<TIters>::value && ...)> {};
+
+template <typename T>
+struct is_reverse_range_iterator : std::false_type {};
+
+template <typename T>
+struct is_reverse_range_iterator<reverse_range_iterator<T>> : std::true_type {};
+
+/* Number of underlying positions between `cursor` and `sentinel` (the shortest of the `zip`-ped sources). */
+template <typename TCursor, typename TSentinel>
+constexpr std::size_t position_distance(const TCursor& cursor, const TSentinel& sentinel) {
+    if constexpr (is_reverse_range_iterator<TCursor>::value) {
+        return impl::position_distance(sentinel.base, cursor.base);
+    } else if constexpr (kissra::tuple_like<TCursor>) {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            return std::min({ std::numeric_limits<std::size_t>::max(),
+                impl::position_distance(std::get<Is>(cursor), std::get<Is>(sentinel))... });
+        }(std::make_index_sequence<std::tuple_size_v<TCursor>>{});
+    } else {
+        return static_cast<std::size_t>(sentinel - cursor);
+    }
+}
+
+/**
+ * `cursor` moved `n` positions towards `sentinel`. Reversed positions are counted from the front of the underlying
+ * range (`positions - n`), since moving backwards `zip` aligns the tails first (see `zip_iter::next_back`): the last
+ * item of a reversed `zip` lies at the shortest remainder of every source, not at their ends.
+ */
+template <typename TCursor, typename TSentinel>
+constexpr TCursor shift_position(const TCursor& cursor, const TSentinel& sentinel, std::size_t n) {
+    if constexpr (is_reverse_range_iterator<TCursor>::value) {
+        const std::size_t positions = impl::position_distance(cursor, sentinel);
+        return TCursor{ impl::shift_position(sentinel.base, cursor.base, positions - n) };
+    } else if constexpr (kissra::tuple_like<TCursor>) {
+        return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            return TCursor{ impl::shift_position(std::get<Is>(cursor), std::get<Is>(sentinel), n)... };
+        }(std::make_index_sequence<std::tuple_size_v<TCursor>>{});
+    } else {
+        return cursor + static_cast<std::iter_difference_t<TCursor>>(n);
+    }
+}
+
+/* Remaining underlying positions of a (fast-forwarded) position splittable iterator. */
+template <typename TIter>
+constexpr std::size_t remaining_positions(const TIter& iter) {
+    return impl::position_distance(iter.underlying_cursor(), iter.underlying_sentinel());
+}
+
+/* Copy of a (fast-forwarded) position splittable `iter` limited to the underlying positions `[first, last)`. */
+template <typename TIter>
+constexpr TIter slice_positions(const TIter& iter, std::size_t first, std::size_t last) {
+    const auto cursor = iter.underlying_cursor();
+    const auto sentinel = iter.underlying_sentinel();
+    TIter slice = iter;
+    /* Same order as in `chunk_iter`: "before" state last. */
+    slice.underlying_sentinel_override(impl::shift_position(cursor, sentinel, last));
+    slice.underlying_cursor_override(impl::shift_position(cursor, sentinel, first));
+    return slice;
+}
+} // namespace impl
+
+template <typename Tag>
+struct split_at_mixin {
+    /**
+     * The first `n` items and the rest of them as two independent iterators. Same mechanics as `chunk(n)`: a copy is
+     * advanced by `n` and the underlying sentinel of the other copy is moved to where it stopped, hence O(1) for random
+     * access iterators and O(n) otherwise. Adaptors state (the count of `take`, the keys seen by `distinct`, ...) is the
+     * one at the start of each part.
+     */
+    template <kissra::mut TSelf>
+        requires is_forward_v<TSelf> && is_common_v<TSelf> && is_monotonic_v<TSelf> &&
+                 std::copy_constructible<std::remove_cvref_t<TSelf>>
+    [[nodiscard]] constexpr auto split_at(this TSelf&& self, std::size_t n) {
+        using iter_t = std::remove_cvref_t<TSelf>;
+
+        /* Fast-forward lazily dropped items (e.g. `drop_while`) so that both parts start out of the same state. */
+        self.advance(0);
+        const auto begin = self.underlying_cursor();
+        iter_t rhs = self;
+        rhs.advance(n);
+
+        iter_t lhs = std::forward<TSelf>(self);
+        lhs.underlying_sentinel_override(rhs.underlying_cursor());
+        lhs.underlying_cursor_override(begin);
+        return std::pair<iter_t, iter_t>{ std::move(lhs), std::move(rhs) };
+    }
+
+    /**
+     * Halves for a work-stealing scheduler, empty if there are less than two items (underlying positions) left.
+     * Sized iterators are cut at `size() / 2` items. Unsized ones (`filter`-ed and such) are cut at the middle
+     * underlying position instead, without evaluating any item - possible over position splittable pipelines only
+     * (`impl::is_position_splittable`). E.g. `chunk(n)` over `filter` can't be cut like that: chunk boundaries depend on
+     * every item before.
+     */
+    template <kissra::mut TSelf>
+        requires is_forward_v<TSelf> && is_common_v<TSelf> && is_monotonic_v<TSelf> &&
+                 std::copy_constructible<std::remove_cvref_t<TSelf>> &&
+                 (is_sized_v<TSelf> || impl::is_position_splittable<std::remove_cvref_t<TSelf>>::value)
+    [[nodiscard]] constexpr auto try_split(this TSelf&& self) {
+        using iter_t = std::remove_cvref_t<TSelf>;
+        using result_t = kissra::optional<std::pair<iter_t, iter_t>>;
+
+        if constexpr (is_sized_v<TSelf>) {
+            const std::size_t size = self.size();
+            return size < 2 ? result_t{} : result_t{ std::forward<TSelf>(self).split_at(size / 2) };
+        } else {
+            self.advance(0);
+            const std::size_t positions = impl::remaining_positions(self);
+            if (positions < 2) {
+                return result_t{};
+            }
+            return result_t{ std::pair<iter_t, iter_t>{
+                impl::slice_positions(self, 0, positions / 2),
+                impl::slice_positions(self, positions / 2, positions),
+            } };
+        }
+    }
+};
+} // namespace kissra
@@ -0,0 +1,304 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/utility.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+/* Summation algorithm of `sum()` (makes a difference for floating-point accumulators only). */
+enum class summation {
+    /* Several independent accumulators (additions are reassociated, the result is deterministic though). */
+    fast,
+    /* Strictly left to right, same as `std::accumulate`. */
+    strict,
+    /* Blocks summed up pairwise (O(log n) error growth, nearly as fast as `fast`). */
+    pairwise,
+    /* Kahan-Babuska compensated summation (O(1) error growth). Don't combine with `-ffast-math`. */
+    kahan,
+};
+
+namespace impl {
+template <typename T>
+using default_sum_t = std::remove_cvref_t<decltype(std::declval<T>() + std::declval<T>())>;
+
+template <typename T>
+using default_product_t = std::remove_cvref_t<decltype(std::declval<T>() * std::declval<T>())>;
+
+/* Reassociating independent accumulators only pays off for (and is only observable with) arithmetic types. */
+template <typename TAcc, summation Summation>
+inline constexpr summation effective_summation =
+    std::is_floating_point_v<TAcc> ? Summation : (std::is_arithmetic_v<TAcc> ? summation::fast : summation::strict);
+
+inline constexpr std::size_t sum_lanes = 8;
+
+/**
+ * Type of the independent accumulators (lanes) for `TAcc`. Signed integers wrap around in their unsigned counterpart:
+ * a lane may overflow even though the total doesn't. Integers narrower than `unsigned` are not promoted to `int` then.
+ */
+template <typename TAcc>
+struct lane_of {
+    using type = TAcc;
+};
+
+template <typename TAcc>
+    requires std::is_integral_v<TAcc> && (!std::is_same_v<TAcc, bool>)
+struct lane_of<TAcc> {
+    using type = std::make_unsigned_t<std::common_type_t<TAcc, unsigned>>;
+};
+
+template <typename TAcc>
+using lane_t = typename lane_of<TAcc>::type;
+
+template <typename TAcc>
+constexpr TAcc sum_lanes_up(const TAcc (&acc)[sum_lanes]) {
+    return ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+}
+
+/**
+ * Kahan-Babuska summation in Klein's second-order form: the error of every addition is itself accumulated with
+ * compensation. Neumaier's first-order compensation alone handles addends greater than the running sum but drifts once
+ * the accumulated error gets large (e.g. a million of `float`s).
+ */
+template <typename TAcc>
+struct kahan_sum {
+    constexpr void add(TAcc value) {
+        const TAcc error = kahan_sum::two_sum(this->sum, value);
+        const TAcc error2 = kahan_sum::two_sum(this->compensation, error);
+        this->compensation2 += error2;
+    }
+
+    constexpr void merge(const kahan_sum& other) {
+        this->add(other.sum);
+        this->add(other.compensation);
+        this->add(other.compensation2);
+    }
+
+    constexpr TAcc result() const {
+        return this->sum + (this->compensation + this->compensation2);
+    }
+
+    TAcc sum{};
+    TAcc compensation{};
+    TAcc compensation2{};
+
+private:
+    /* `acc += value` returning the rounding error of the addition (branch-free, hence vectorizable). */
+    static constexpr TAcc two_sum(TAcc& acc, TAcc value) {
+        const TAcc total = acc + value;
+        const TAcc abs_acc = acc < 0 ? -acc : acc;
+        const TAcc abs_value = value < 0 ? -value : value;
+        const TAcc error = abs_acc >= abs_value ? (acc - total) + value : (value - total) + acc;
+        acc = total;
+        return error;
+    }
+};
+
+/**
+ * Streaming pairwise summation: items are summed up in blocks, block sums are combined like a binary counter carries
+ * (a block sum at `level` covers `2^level` blocks), so that every addition combines two operands of similar magnitude.
+ */
+template <typename TAcc>
+class pairwise_sum {
+public:
+    static constexpr std::size_t block_size = 128;
+
+    constexpr void add(TAcc value) {
+        this->block += value;
+        if (++this->block_items == block_size) {
+            this->add_block(std::exchange(this->block, TAcc{}));
+            this->block_items = 0;
+        }
+    }
+
+    constexpr void add_block(TAcc block_sum) {
+        std::size_t level = 0;
+        for (auto carry = this->blocks++; carry & 1; carry >>= 1, ++level) {
+            block_sum = this->levels[level] + block_sum;
+        }
+        this->levels[level] = block_sum;
+    }
+
+    constexpr TAcc result() const {
+        TAcc total{};
+        for (std::size_t level = 0, blocks = this->blocks; blocks != 0; blocks >>= 1, ++level) {
+            if (blocks & 1) {
+                total += this->levels[level];
+            }
+        }
+        return total + this->block;
+    }
+
+private:
+    TAcc levels[64]{};
+    TAcc block{};
+    std::uint64_t blocks = 0;
+    std::size_t block_items = 0;
+};
+
+/**
+ * Sum of (filtered) contiguous arithmetic items. Rejected items are masked out (added as zeros) so that the loops stay
+ * branch-free and get auto-vectorized, lanes are independent accumulators which hide the latency of additions.
+ */
+template <typename TAcc, summation Summation, typename U, typename TStage>
+constexpr TAcc sum_kernel(std::span<U> items, TStage& stage) {
+    const auto value_of = [&](U& item) {
+        const auto [passes, value] = stage(item);
+        return passes ? static_cast<TAcc>(value) : TAcc{};
+    };
+
+    const std::size_t size = items.size();
+    if constexpr (Summation == summation::strict) {
+        TAcc acc{};
+        for (std::size_t i = 0; i != size; ++i) {
+            acc += value_of(items[i]);
+        }
+        return acc;
+    } else if constexpr (Summation == summation::fast) {
+        lane_t<TAcc> acc[sum_lanes]{};
+        std::size_t i = 0;
+        for (; i + sum_lanes <= size; i += sum_lanes) {
+            for (std::size_t l = 0; l != sum_lanes; ++l) {
+                acc[l] += static_cast<lane_t<TAcc>>(value_of(items[i + l]));
+            }
+        }
+        for (; i < size; ++i) {
+            acc[i % sum_lanes] += static_cast<lane_t<TAcc>>(value_of(items[i]));
+        }
+        return static_cast<TAcc>(impl::sum_lanes_up(acc));
+    } else if constexpr (Summation == summation::pairwise) {
+        constexpr std::size_t block_size = pairwise_sum<TAcc>::block_size;
+        static_assert(block_size % sum_lanes == 0);
+
+        pairwise_sum<TAcc> acc;
+        std::size_t i = 0;
+        for (; i + block_size <= size; i += block_size) {
+            TAcc block[sum_lanes]{};
+            for (std::size_t j = 0; j != block_size; j += sum_lanes) {
+                for (std::size_t l = 0; l != sum_lanes; ++l) {
+                    block[l] += value_of(items[i + j + l]);
+                }
+            }
+            acc.add_block(impl::sum_lanes_up(block));
+        }
+        for (; i < size; ++i) {
+            acc.add(value_of(items[i]));
+        }
+        return acc.result();
+    } else {
+        kahan_sum<TAcc> acc[sum_lanes]{};
+        std::size_t i = 0;
+        for (; i + sum_lanes <= size; i += sum_lanes) {
+            for (std::size_t l = 0; l != sum_lanes; ++l) {
+                acc[l].add(value_of(items[i + l]));
+            }
+        }
+        for (; i < size; ++i) {
+            acc[i % sum_lanes].add(value_of(items[i]));
+        }
+        for (std::size_t l = 1; l != sum_lanes; ++l) {
+            acc[0].merge(acc[l]);
+        }
+        return acc[0].result();
+    }
+}
+
+template <typename TAcc, summation Summation, typename TIter>
+constexpr TAcc sum(TIter& iter) {
+    if constexpr (impl::filtered_contiguous_arithmetic_source<TIter>) {
+        auto [items, stage] = impl::filtered_contiguous_source(iter);
+        const auto result = impl::sum_kernel<TAcc, Summation>(items, stage);
+        impl::consume_contiguous_source(iter);
+        return result;
+    } else if constexpr (Summation == summation::fast) {
+        /* Round-robin over a few accumulators still breaks the dependency chain of additions. */
+        lane_t<TAcc> acc[4]{};
+        for (std::size_t i = 0; auto item = iter.next(); ++i) {
+            acc[i % 4] += static_cast<lane_t<TAcc>>(static_cast<TAcc>(*item));
+        }
+        return static_cast<TAcc>((acc[0] + acc[1]) + (acc[2] + acc[3]));
+    } else if constexpr (Summation == summation::strict) {
+        TAcc acc{};
+        while (auto item = iter.next()) {
+            acc += static_cast<TAcc>(std::forward_like<iter_reference_t<TIter>>(*item));
+        }
+        return acc;
+    } else {
+        std::conditional_t<Summation == summation::pairwise, pairwise_sum<TAcc>, kahan_sum<TAcc>> acc;
+        while (auto item = iter.next()) {
+            acc.add(static_cast<TAcc>(*item));
+        }
+        return acc.result();
+    }
+}
+
+template <typename TAcc, typename TIter>
+constexpr TAcc product(TIter& iter) {
+    if constexpr (impl::filtered_contiguous_arithmetic_source<TIter> && std::is_arithmetic_v<TAcc>) {
+        auto [items, stage] = impl::filtered_contiguous_source(iter);
+        const std::size_t size = items.size();
+        const auto value_of = [&](auto& item) {
+            const auto [passes, value] = stage(item);
+            return passes ? static_cast<TAcc>(value) : TAcc(1);
+        };
+
+        lane_t<TAcc> acc[sum_lanes];
+        for (auto& lane : acc) {
+            lane = lane_t<TAcc>(1);
+        }
+        std::size_t i = 0;
+        for (; i + sum_lanes <= size; i += sum_lanes) {
+            for (std::size_t l = 0; l != sum_lanes; ++l) {
+                acc[l] *= static_cast<lane_t<TAcc>>(value_of(items[i + l]));
+            }
+        }
+        for (; i < size; ++i) {
+            acc[i % sum_lanes] *= static_cast<lane_t<TAcc>>(value_of(items[i]));
+        }
+        impl::consume_contiguous_source(iter);
+        return static_cast<TAcc>(((acc[0] * acc[1]) * (acc[2] * acc[3])) * ((acc[4] * acc[5]) * (acc[6] * acc[7])));
+    } else {
+        TAcc acc(1);
+        while (auto item = iter.next()) {
+            acc *= static_cast<TAcc>(std::forward_like<iter_reference_t<TIter>>(*item));
+        }
+        return acc;
+    }
+}
+} // namespace impl
+
+template <typename Tag>
+struct sum_mixin {
+    /**
+     * Sum of all the items (`TAcc{}` if there are none). `TAcc` is the accumulator (and the result) type, by default
+     * the type of `item + item` (so that e.g. `char`s are summed up as `int`s) - pass a wider one to avoid overflows.
+     */
+    template <typename TAcc = void, summation Summation = summation::fast, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto sum(this TSelf&& self) {
+        using acc_t = std::conditional_t<std::is_void_v<TAcc>, impl::default_sum_t<iter_value_t<TSelf>>, TAcc>;
+        return impl::sum<acc_t, impl::effective_summation<acc_t, Summation>>(self);
+    }
+
+    /* `sum<kissra::summation::kahan>()`, `sum<kissra::summation::pairwise, double>()` etc. */
+    template <summation Summation, typename TAcc = void, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto sum(this TSelf&& self) {
+        return self.template sum<TAcc, Summation>();
+    }
+
+    /* Product of all the items (`TAcc(1)` if there are none). */
+    template <typename TAcc = void, kissra::mut TSelf>
+    [[nodiscard]] constexpr auto product(this TSelf&& self) {
+        using acc_t = std::conditional_t<std::is_void_v<TAcc>, impl::default_product_t<iter_value_t<TSelf>>, TAcc>;
+        return impl::product<acc_t>(self);
+    }
+};
+} // namespace kissra
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+#include "kissra/concepts.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
+#include "kissra/impl/export.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/type_traits.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/* Replace the top of a heap (w.r.t. `before`) with `value` restoring the heap property with a single sift-down. */
+template <typename T, typename TValue, typename TBefore>
+constexpr void heap_replace_top(std::vector<T>& heap, TValue&& value, TBefore& before) {
+    const std::size_t size = heap.size();
+    std::size_t hole = 0;
+    while (true) {
+        std::size_t child = 2 * hole + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && before(heap[child], heap[child + 1])) {
+            ++child;
+        }
+        if (!before(value, heap[child])) {
+            break;
+        }
+        heap[hole] = std::move(heap[child]);
+        hole = child;
+    }
+    heap[hole] = std::forward<TValue>(value);
+}
+
+/**
+ * The first `k` items w.r.t. `before` sorted accordingly. Retained items are kept in a bounded heap whose top is the
+ * "worst" of them (the threshold): an item which doesn't go `before` the threshold is skipped after one comparison.
+ * For contiguous arithmetic items compared naturally the threshold check runs over whole blocks first (vectorized),
+ * the heap is only touched for blocks which contain at least one candidate.
+ */
+template <typename TIter, typename TBefore>
+constexpr auto select_k(TIter& iter, std::size_t k, TBefore before) {
+    using val_t = kissra::iter_value_t<TIter>;
+    using ref_t = kissra::iter_reference_t<TIter>;
+
+    std::vector<val_t> heap;
+    if (k == 0) {
+        return heap;
+    }
+    if constexpr (kissra::is_sized_v<TIter>) {
+        heap.reserve(std::min(k, iter.size()));
+    } else {
+        heap.reserve(k);
+    }
+
+    const auto offer = [&]<typename TItem>(TItem&& item) {
+        if (heap.size() < k) {
+            heap.push_back(std::forward<TItem>(item));
+            std::push_heap(heap.begin(), heap.end(), before);
+        } else if (before(item, heap.front())) {
+            impl::heap_replace_top(heap, std::forward<TItem>(item), before);
+        }
+    };
+
+    if constexpr (impl::contiguous_arithmetic_iterator<TIter> && TBefore::is_natural) {
+        const auto items = impl::remaining_span(iter);
+        std::size_t i = 0;
+        for (; i != items.size() && heap.size() < k; ++i) {
+            offer(items[i]);
+        }
+        while (items.size() - i >= impl::kernel_block_size) {
+            const auto threshold = heap.front();
+            bool any_candidate = false;
+            for (std::size_t j = 0; j != impl::kernel_block_size; ++j) {
+                any_candidate |= before(items[i + j], threshold);
+            }
+            if (any_candidate) {
+                for (std::size_t j = 0; j != impl::kernel_block_size; ++j) {
+                    offer(items[i + j]);
+                }
+            }
+            i += impl::kernel_block_size;
+        }
+        for (; i != items.size(); ++i) {
+            offer(items[i]);
+        }
+        iter.advance(items.size());
+    } else {
+        while (auto item = iter.next()) {
+            offer(std::forward_like<ref_t>(*item));
+        }
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), before);
+    return heap;
+}
+
+/* `cmp(proj(l), proj(r))` (or flipped), remembers whether it is a plain `<`/`>` over items. */
+template <typename TCmp, typename TProj, bool Flipped>
+struct projected_before {
+    static constexpr bool is_natural = impl::natural_order<TCmp> && std::same_as<TProj, std::identity>;
+
+    template <typename Lhs, typename Rhs>
+    constexpr bool operator()(const Lhs& l, const Rhs& r) const {
+        if constexpr (Flipped) {
+            return static_cast<bool>(kissra::invoke(cmp, kissra::invoke(proj, r), kissra::invoke(proj, l)));
+        } else {
+            return static_cast<bool>(kissra::invoke(cmp, kissra::invoke(proj, l), kissra::invoke(proj, r)));
+        }
+    }
+
+    [[no_unique_address]] TCmp cmp;
+    [[no_unique_address]] TProj proj;
+};
+} // namespace impl
+
+template <typename Tag>
+struct top_k_mixin {
+    /**
+     * `k` greatest items (w.r.t. `cmp` over `proj`-ected items) sorted in descending order - same as `collect()` followed
+     * by `std::partial_sort` but without materializing the whole input (memory is O(k)).
+     */
+    template <kissra::mut TSelf, typename TCmp = std::ranges::less, typename TProj = std::identity>
+    [[nodiscard]] constexpr auto top_k(this TSelf&& self, std::size_t k, TCmp cmp = {}, TProj proj = {}) {
+        return impl::select_k(self, k, impl::projected_before<TCmp, TProj, true>{ cmp, proj });
+    }
+
+    /* `k` least items (w.r.t. `cmp` over `proj`-ected items) sorted in ascending order. */
+    template <kissra::mut TSelf, typename TCmp = std::ranges::less, typename TProj = std::identity>
+    [[nodiscard]] constexpr auto bottom_k(this TSelf&& self, std::size_t k, TCmp cmp = {}, TProj proj = {}) {
+        return impl::select_k(self, k, impl::projected_before<TCmp, TProj, false>{ cmp, proj });
+    }
+};
+} // namespace kissra
\ No newline at end of file
@@ -0,0 +1,312 @@
+#pragma once
+#include "kissra/impl/compose.hpp"
+#include "kissra/impl/into_iter.hpp"
+#include "kissra/impl/iter/iter_base.hpp"
+
+#ifndef KISSRA_MODULE
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+/**
+ * Store the latest evaluated item inline so that peeking (`front()`, `nth(0)`, `back()`, `nth_back(0)`) followed by
+ * consuming (`next()`, `next_back()`) evaluates the underlying item only once.
+ * Items keep the reference type of the underlying iterator: a peek hands out a copy of the cached prvalue (or the
+ * prvalue itself if it isn't copyable, dropping the cache), the consuming call moves the cached prvalue out.
+ */
+template <typename TBaseIter, template <typename> typename... TMixins>
+class cache_latest_iter : public iter_base<TBaseIter>, public builtin_mixins<TBaseIter>, public TMixins<TBaseIter>... {
+    enum class cached_end : unsigned char { none, front, back };
+
+public:
+    using value_type = typename TBaseIter::value_type;
+    using reference = typename TBaseIter::reference;
+    using result_t = typename TBaseIter::result_t;
+    using cursor_t = typename TBaseIter::cursor_t;
+    using sentinel_t = typename TBaseIter::sentinel_t;
+
+    static constexpr bool is_sized = TBaseIter::is_sized;
+    static constexpr bool is_common = TBaseIter::is_common;
+    static constexpr bool is_forward = TBaseIter::is_forward;
+    static constexpr bool is_bidir = TBaseIter::is_bidir;
+    static constexpr bool is_random = TBaseIter::is_random;
+    static constexpr bool is_contiguous = false;
+    static constexpr bool is_monotonic = TBaseIter::is_monotonic;
+
+    template <kissra::not_the_same<cache_latest_iter> UBaseIter>
+    constexpr explicit cache_latest_iter(UBaseIter&& base_iter)
+        : iter_base<TBaseIter>(std::forward<UBaseIter>(base_iter)) {}
+
+    [[nodiscard]] constexpr result_t next() {
+        if (std::exchange(this->end, cached_end::none) == cached_end::front) {
+            /* The cached item is the one under the cursor - consume it without evaluating it again. */
+            this->base_iter.advance(1);
+            return std::move(this->cache);
+        }
+        return this->base_iter.next();
+    }
+
+    [[nodiscard]] constexpr result_t next_back()
+        requires is_common && is_bidir
+    {
+        if (std::exchange(this->end, cached_end::none) == cached_end::back) {
+            this->base_iter.advance_back(1);
+            return std::move(this->cache);
+        }
+        return this->base_iter.next_back();
+    }
+
+    [[nodiscard]] constexpr result_t nth(std::size_t n) {
+        this->cache_nth(n);
+        return this->peeked();
+    }
+
+    [[nodiscard]] constexpr result_t nth_back(std::size_t n)
+        requires is_common && is_bidir
+    {
+        this->cache_nth_back(n);
+        return this->peeked();
+    }
+
+    /**
+     * Skip the items not passing `pred` and keep the first one which does cached (`front()` hands it out). The items
+     * are handed to `pred` as lvalues straight out of the cache, so scanning doesn't copy them.
+     */
+    template <typename TPred>
+    constexpr bool skip_until(TPred pred) {
+        for (std::size_t n = 0; this->cache_nth(n); n = 1) {
+            if (pred(*this->cache)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename TPred>
+    constexpr bool skip_back_until(TPred pred)
+        requires is_common && is_bidir
+    {
+        for (std::size_t n = 0; this->cache_nth_back(n); n = 1) {
+            if (pred(*this->cache)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    constexpr std::size_t advance(std::size_t n) {
+        if (n != 0) {
+            this->end = cached_end::none;
+        }
+        return this->base_iter.advance(n);
+    }
+
+    constexpr std::size_t advance_back(std::size_t n)
+        requires is_bidir
+    {
+        if (n != 0) {
+            this->end = cached_end::none;
+        }
+        return this->base_iter.advance_back(n);
+    }
+
+    constexpr auto size() const
+        requires is_sized
+    {
+        return this->base_iter.size();
+    }
+
+    constexpr void underlying_cursor_override(cursor_t cursor) {
+        if (!same_position(this->base_iter.underlying_cursor(), cursor)) {
+            /* The back item survives as long as the new cursor provably doesn't cut it off (see `chunk_iter`). */
+            const bool back_survives =
+                this->end == cached_end::back && distinct_position(cursor, this->base_iter.underlying_sentinel());
+            this->end = back_survives ? cached_end::back : cached_end::none;
+        }
+        this->base_iter.underlying_cursor_override(cursor);
+    }
+
+    constexpr void underlying_sentinel_override(sentinel_t sentinel) {
+        if (!same_position(this->base_iter.underlying_sentinel(), sentinel)) {
+            /* Same for the front item and the new sentinel. */
+            const bool front_survives =
+                this->end == cached_end::front && distinct_position(this->base_iter.underlying_cursor(), sentinel);
+            this->end = front_survives ? cached_end::front : cached_end::none;
+        }
+        this->base_iter.underlying_sentinel_override(sentinel);
+    }
+
+private:
+    constexpr bool cache_nth(std::size_t n) {
+        if (n != 0 || this->end != cached_end::front) {
+            this->cache = this->base_iter.nth(n);
+            this->end = this->cache ? cached_end::front : cached_end::none;
+        }
+        return this->end == cached_end::front;
+    }
+
+    constexpr bool cache_nth_back(std::size_t n) {
+        if (n != 0 || this->end != cached_end::back) {
+            this->cache = this->base_iter.nth_back(n);
+            this->end = this->cache ? cached_end::back : cached_end::none;
+        }
+        return this->end == cached_end::back;
+    }
+
+    /* The cached item stays there for the consuming call. */
+    constexpr result_t peeked() {
+        if constexpr (std::is_reference_v<reference> || std::copy_constructible<reference>) {
+            return this->cache;
+        } else {
+            this->end = cached_end::none;
+            return std::move(this->cache);
+        }
+    }
+
+    template <typename Lhs, typename Rhs>
+    static constexpr bool same_position(const Lhs& l, const Rhs& r) {
+        if constexpr (requires { { l == r } -> std::convertible_to<bool>; }) {
+            return l == r;
+        } else {
+            return false;
+        }
+    }
+
+    template <typename Lhs, typename Rhs>
+    static constexpr bool distinct_position(const Lhs& l, const Rhs& r) {
+        if constexpr (requires { { l != r } -> std::convertible_to<bool>; }) {
+            return l != r;
+        } else {
+            return false;
+        }
+    }
+
+private:
+    result_t cache{};
+    cached_end end{};
+};
+
+namespace impl {
+/**
+ * Adaptors which peek an item and consume it later (`filter`, `drop_while`, `drop_last_while`) evaluate the underlying
+ * item twice. It only matters for prvalues owning resources (`std::string` out of `fn::to_chars` for instance) - for
+ * those the `cache_latest_iter` is inserted automatically.
+ */
+template <typename TIter>
+concept cache_latest_beneficial =
+    !std::is_reference_v<iter_reference_t<TIter>> && !std::is_trivially_destructible_v<iter_value_t<TIter>>;
+
+template <typename TIter>
+struct is_cache_latest_iter : std::false_type {};
+
+template <typename TBaseIter, template <typename> typename... TMixins>
+struct is_cache_latest_iter<cache_latest_iter<TBaseIter, TMixins...>> : std::true_type {};
+
+template <bool Back, typename TIter>
+constexpr typename TIter::result_t peek_nth(TIter& iter, std::size_t n) {
+    if constexpr (Back) {
+        return iter.nth_back(n);
+    } else {
+        return iter.nth(n);
+    }
+}
+
+/**
+ * Skip the items (from the front, or from the back if `Back`) not passing `pred`, `pred` gets them as lvalues.
+ * `peek_until` also peeks the first item which passes. Over a `cache_latest_iter` the skipped items aren't copied.
+ */
+template <bool Back = false, typename TIter, typename TPred>
+constexpr void skip_until(TIter& iter, TPred pred) {
+    if constexpr (is_cache_latest_iter<TIter>::value) {
+        if constexpr (Back) {
+            iter.skip_back_until(pred);
+        } else {
+            iter.skip_until(pred);
+        }
+    } else {
+        for (auto item = impl::peek_nth<Back>(iter, 0); item; item = impl::peek_nth<Back>(iter, 1)) {
+            if (pred(*item)) {
+                break;
+            }
+        }
+    }
+}
+
+template <bool Back = false, typename TIter, typename TPred>
+constexpr typename TIter::result_t peek_until(TIter& iter, TPred pred) {
+    if constexpr (is_cache_latest_iter<TIter>::value) {
+        if constexpr (Back) {
+            return iter.skip_back_until(pred) ? iter.back() : typename TIter::result_t{};
+        } else {
+            return iter.skip_until(pred) ? iter.front() : typename TIter::result_t{};
+        }
+    } else {
+        for (auto item = impl::peek_nth<Back>(iter, 0); item; item = impl::peek_nth<Back>(iter, 1)) {
+            if (pred(*item)) {
+                return item;
+            }
+        }
+        return {};
+    }
+}
+
+template <template <typename> typename... TMixins, typename TIter>
+constexpr decltype(auto) auto_cache_latest(TIter&& iter) {
+    if constexpr (cache_latest_beneficial<TIter>) {
+        return cache_latest_iter<std::remove_cvref_t<TIter>, TMixins...>{ std::forward<TIter>(iter) };
+    } else {
+        return std::forward<TIter>(iter);
+    }
+}
+
+template <typename TIter, template <typename> typename... TMixins>
+using auto_cache_latest_t = std::remove_cvref_t<decltype(impl::auto_cache_latest<TMixins...>(std::declval<TIter>()))>;
+} // namespace impl
+
+template <typename Tag>
+struct cache_latest_mixin {
+    template <typename TSelf, typename DeferInstantiation = void>
+    constexpr auto cache_latest(this TSelf&& self) {
+        return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+            return cache_latest_iter<std::remove_cvref_t<TSelf>, TMixins...>{ std::forward<TSelf>(self) };
+        });
+    }
+};
+
+template <kissra::iterator_compatible T, typename DeferInstantiation = void>
+constexpr auto cache_latest(T&& rng_or_kissra_iter) {
+    return impl::into_kissra_iter<DeferInstantiation>(KISSRA_FWD(rng_or_kissra_iter)).cache_latest();
+}
+
+
+namespace compo {
+template <typename TBaseCompose, template <typename> typename... TMixinsCompose>
+struct cache_latest_compose : public builtin_mixins_compose<TBaseCompose>, public TMixinsCompose<TBaseCompose>... {
+    [[no_unique_address]] TBaseCompose base_comp;
+
+    template <template <typename> typename... TMixins, typename TSelf, kissra::iterator UBaseIter>
+    constexpr auto make_iter(this TSelf&& self, UBaseIter&& base_iter) {
+        return cache_latest_iter<std::remove_cvref_t<UBaseIter>, TMixins...>{ std::forward<UBaseIter>(base_iter) };
+    }
+};
+
+template <typename Tag>
+struct cache_latest_compose_mixin {
+    template <typename TSelf, typename DeferInstantiation = void>
+    constexpr auto cache_latest(this TSelf&& self) {
+        return with_custom_mixins_compose<DeferInstantiation>([&]<template <typename> typename... TMixinsCompose> {
+            return cache_latest_compose<std::remove_cvref_t<TSelf>, TMixinsCompose...>{ .base_comp = std::forward<TSelf>(self) };
+        });
+    }
+};
+
+template <typename DeferInstantiation = void>
+constexpr auto cache_latest() {
+    return compose<DeferInstantiation>().cache_latest();
+}
+} // namespace compo
+} // namespace kissra
\ No newline at end of file
@@ -0,0 +1,241 @@
+#pragma once
+#include "kissra/impl/compose.hpp"
+#include "kissra/impl/iter/cache_latest_iter.hpp"
+#include "kissra/impl/iter/iter_base.hpp"
+#include "kissra/misc/flat_hash_map.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/misc/optional.hpp"
+#include "kissra/misc/utility.hpp"
+
+#ifndef KISSRA_MODULE
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/* Integral keys with at most 2^16 possible values: those are tracked by a bitmap (8KiB at most) instead of a hash set. */
+template <typename TKey>
+concept small_integral_key = std::integral<TKey> && sizeof(TKey) <= 2;
+
+/* Keys seen by a `distinct_iter` so far. */
+template <typename TKey>
+class distinct_keys {
+public:
+    constexpr explicit distinct_keys(std::size_t capacity_hint)
+        : keys(capacity_hint) {}
+
+    /* Whether `key` has not been seen before. */
+    template <typename TKeyArg>
+    constexpr bool insert(TKeyArg&& key) {
+        return this->keys.insert(std::forward<TKeyArg>(key));
+    }
+
+    constexpr bool contains(const TKey& key) const {
+        return this->keys.contains(key);
+    }
+
+private:
+    kissra::flat_hash_set<TKey> keys;
+};
+
+template <small_integral_key TKey>
+class distinct_keys<TKey> {
+public:
+    constexpr explicit distinct_keys(std::size_t)
+        : bits((distinct_keys::domain + 63) / 64) {}
+
+    constexpr bool insert(TKey key) {
+        const auto i = distinct_keys::index_of(key);
+        std::uint64_t& word = this->bits[i / 64];
+        const std::uint64_t mask = std::uint64_t(1) << (i % 64);
+        const bool inserted = !(word & mask);
+        word |= mask;
+        return inserted;
+    }
+
+    constexpr bool contains(TKey key) const {
+        const auto i = distinct_keys::index_of(key);
+        return (this->bits[i / 64] >> (i % 64)) & 1;
+    }
+
+private:
+    static constexpr std::int64_t min = std::numeric_limits<TKey>::min();
+    static constexpr std::size_t domain = std::size_t(std::int64_t(std::numeric_limits<TKey>::max()) - min + 1);
+
+    static constexpr std::size_t index_of(TKey key) {
+        return static_cast<std::size_t>(std::int64_t(key) - min);
+    }
+
+    std::vector<std::uint64_t> bits;
+};
+} // namespace impl
+
+/**
+ * Yields the first occurrence of every `proj`-ected key (of every item if `proj` is `std::identity`), in the original
+ * order. Duplicates don't have to be adjacent: seen keys are kept in an open-addressing hash set (key hashes stored
+ * aside, so that growing never rehashes a key) or in a bitmap for 8 and 16 bit integral keys.
+ * `advance(n)` keeps a copy of the keys seen so far, so that `chunk(k)` and `split_at(n)` parts start out of the keys
+ * seen before them (this copy is what every chunk costs on top of the copy of the iterator itself).
+ */
+template <typename TBaseIter, typename TProj, template <typename> typename... TMixins>
+    requires kissra::regular_invocable<TProj, typename TBaseIter::reference&>
+class distinct_iter : public iter_base<TBaseIter>, public builtin_mixins<TBaseIter>, public TMixins<TBaseIter>... {
+public:
+    using value_type = typename TBaseIter::value_type;
+    using reference = typename TBaseIter::reference;
+    using result_t = typename TBaseIter::result_t;
+    using cursor_t = typename TBaseIter::cursor_t;
+    using sentinel_t = typename TBaseIter::sentinel_t;
+    using key_type = std::remove_cvref_t<kissra::invoke_result_t<TProj&, reference&>>;
+
+    static constexpr bool is_sized = false;
+    static constexpr bool is_common = TBaseIter::is_common;
+    static constexpr bool is_forward = TBaseIter::is_forward;
+    /* The first occurrence of a key is only known when iterating from the front. */
+    static constexpr bool is_bidir = false;
+    static constexpr bool is_random = false;
+    static constexpr bool is_contiguous = false;
+    /* Copies moved back within the already iterated part get their seen keys back, see `underlying_cursor_override`. */
+    static constexpr bool is_monotonic = TBaseIter::is_monotonic && std::equality_comparable<cursor_t>;
+
+    template <typename UBaseIter>
+    constexpr distinct_iter(UBaseIter&& base_iter, TProj proj, std::size_t capacity_hint)
+        : iter_base<TBaseIter>(std::forward<UBaseIter>(base_iter))
+        , proj(proj)
+        , seen(capacity_hint) {}
+
+    [[nodiscard]] constexpr result_t next() {
+        while (auto item = this->base_iter.next()) {
+            if (this->seen.insert(kissra::invoke(this->proj.inst, *item))) {
+                return item;
+            }
+        }
+        return {};
+    }
+
+    /* The item is not marked as seen: the cursor stays at it, so it is the one `next()` yields. */
+    [[nodiscard]] constexpr result_t nth(std::size_t n) {
+        this->advance(n);
+        return impl::peek_until(this->base_iter, [&](auto& item) {
+            return !this->seen.contains(kissra::invoke(this->proj.inst, item));
+        });
+    }
+
+    constexpr std::size_t advance(std::size_t n) {
+        if constexpr (is_monotonic) {
+            if (n != 0) {
+                /* `chunk` and `split_at` copy the iterator once advanced and move the copy back to where it started. */
+                this->snapshot.emplace(this->base_iter.underlying_cursor(), this->seen);
+            }
+        }
+        std::size_t offset = 0;
+        while (offset != n && this->next()) {
+            ++offset;
+        }
+        return offset;
+    }
+
+    /* Keys seen before the cursor are restored if the cursor goes back to where the latest `advance(n)` started. */
+    constexpr void underlying_cursor_override(cursor_t cursor) {
+        if constexpr (is_monotonic) {
+            if (this->snapshot && this->snapshot->first == cursor) {
+                this->seen = std::move(this->snapshot->second);
+                this->snapshot.reset();
+            }
+        }
+        this->base_iter.underlying_cursor_override(cursor);
+    }
+
+private:
+    [[no_unique_address]] functor_ebo<TProj, TBaseIter> proj;
+    impl::distinct_keys<key_type> seen;
+    kissra::optional<std::pair<cursor_t, impl::distinct_keys<key_type>>> snapshot;
+};
+
+template <typename Tag>
+struct distinct_mixin {
+    /* Unique items (first occurrences), `capacity_hint` is the expected number of them. */
+    template <typename TSelf>
+    constexpr auto distinct(this TSelf&& self, std::size_t capacity_hint = 0) {
+        return std::forward<TSelf>(self).distinct_by(std::identity{}, capacity_hint);
+    }
+
+    /* Items with a unique `proj`-ected key (first occurrences), `capacity_hint` is the expected number of keys. */
+    template <typename TSelf, typename TProj, typename DeferInstantiation = void>
+    constexpr auto distinct_by(this TSelf&& self, TProj proj, std::size_t capacity_hint = 0) {
+        return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+            using base_iter_t = impl::auto_cache_latest_t<TSelf, TMixins...>;
+            return distinct_iter<base_iter_t, TProj, TMixins...>{
+                impl::auto_cache_latest<TMixins...>(std::forward<TSelf>(self)),
+                proj,
+                capacity_hint,
+            };
+        });
+    }
+};
+
+template <kissra::iterator_compatible T, typename DeferInstantiation = void>
+constexpr auto distinct(T&& rng_or_kissra_iter, std::size_t capacity_hint = 0) {
+    return impl::into_kissra_iter<DeferInstantiation>(KISSRA_FWD(rng_or_kissra_iter)).distinct(capacity_hint);
+}
+
+template <kissra::iterator_compatible T, typename TProj, typename DeferInstantiation = void>
+constexpr auto distinct_by(T&& rng_or_kissra_iter, TProj proj, std::size_t capacity_hint = 0) {
+    return impl::into_kissra_iter<DeferInstantiation>(KISSRA_FWD(rng_or_kissra_iter)).distinct_by(proj, capacity_hint);
+}
+
+namespace compo {
+template <typename TBaseCompose, typename TProj, template <typename> typename... TMixinsCompose>
+struct distinct_compose : public builtin_mixins_compose<TBaseCompose>, public TMixinsCompose<TBaseCompose>... {
+    [[no_unique_address]] TBaseCompose base_comp;
+    [[no_unique_address]] functor_ebo<TProj, TBaseCompose> proj;
+    std::size_t capacity_hint;
+
+    template <template <typename> typename... TMixins, typename TSelf, kissra::iterator UBaseIter>
+    constexpr auto make_iter(this TSelf&& self, UBaseIter&& base_iter) {
+        return distinct_iter<impl::auto_cache_latest_t<UBaseIter, TMixins...>, TProj, TMixins...>{
+            impl::auto_cache_latest<TMixins...>(std::forward<UBaseIter>(base_iter)),
+            std::forward<TSelf>(self).proj.inst,
+            self.capacity_hint,
+        };
+    }
+};
+
+template <typename Tag>
+struct distinct_compose_mixin {
+    template <typename TSelf>
+    constexpr auto distinct(this TSelf&& self, std::size_t capacity_hint = 0) {
+        return std::forward<TSelf>(self).distinct_by(std::identity{}, capacity_hint);
+    }
+
+    template <typename TSelf, typename TProj, typename DeferInstantiation = void>
+    constexpr auto distinct_by(this TSelf&& self, TProj proj, std::size_t capacity_hint = 0) {
+        return with_custom_mixins_compose<DeferInstantiation>([&]<template <typename> typename... TMixinsCompose> {
+            return distinct_compose<std::remove_cvref_t<TSelf>, TProj, TMixinsCompose...>{
+                .base_comp = std::forward<TSelf>(self),
+                .proj = proj,
+                .capacity_hint = capacity_hint,
+            };
+        });
+    }
+};
+
+template <typename DeferInstantiation = void>
+constexpr auto distinct(std::size_t capacity_hint = 0) {
+    return compose<DeferInstantiation>().distinct(capacity_hint);
+}
+
+template <typename TProj, typename DeferInstantiation = void>
+constexpr auto distinct_by(TProj proj, std::size_t capacity_hint = 0) {
+    return compose<DeferInstantiation>().distinct_by(proj, capacity_hint);
+}
+} // namespace compo
+} // namespace kissra
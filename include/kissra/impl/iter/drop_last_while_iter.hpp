@@ -1,5 +1,6 @@
 #pragma once
 #include "kissra/impl/compose.hpp"
+#include "kissra/impl/iter/cache_latest_iter.hpp"
 #include "kissra/impl/iter/iter_base.hpp"
 #include "kissra/misc/functional.hpp"
 
@@ -86,11 +87,9 @@ private:
 
     constexpr void ff_self() {
         if (!std::exchange(this->dropped, true)) {
-            for (auto item = this->base_iter.back(); item; item = this->base_iter.nth_back(1)) {
-                if (!kissra::invoke(this->fn.inst, std::forward_like<reference>(*item))) {
-                    break;
-                }
-            }
+            impl::skip_until<true>(this->base_iter, [&](auto& item) {
+                return !kissra::invoke(this->fn.inst, std::forward_like<reference>(item));
+            });
         }
     }
 
@@ -105,7 +104,8 @@ struct drop_last_while_mixin {
         requires is_common_v<TSelf> && is_bidir_v<TSelf>
     constexpr auto drop_last_while(this TSelf&& self, TFn fn) {
         return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
-            return drop_last_while_iter<std::remove_cvref_t<TSelf>, TFn, TMixins...>{ std::forward<TSelf>(self), fn };
+            using base_iter_t = impl::auto_cache_latest_t<TSelf, TMixins...>;
+            return drop_last_while_iter<base_iter_t, TFn, TMixins...>{ impl::auto_cache_latest<TMixins...>(std::forward<TSelf>(self)), fn };
         });
     }
 };
@@ -119,8 +119,8 @@ struct drop_last_while_compose : public builtin_mixins_compose<TBaseCompose>, pu
 
     template <template <typename> typename... TMixins, typename TSelf, kissra::iterator UBaseIter>
     constexpr auto make_iter(this TSelf&& self, UBaseIter&& base_iter) {
-        return drop_last_while_iter<std::remove_cvref_t<UBaseIter>, TFn, TMixins...>{
-            std::forward<UBaseIter>(base_iter),
+        return drop_last_while_iter<impl::auto_cache_latest_t<UBaseIter, TMixins...>, TFn, TMixins...>{
+            impl::auto_cache_latest<TMixins...>(std::forward<UBaseIter>(base_iter)),
             std::forward<TSelf>(self).fn.inst,
         };
     }
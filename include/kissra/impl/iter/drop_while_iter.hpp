@@ -1,5 +1,6 @@
 #pragma once
 #include "kissra/impl/compose.hpp"
+#include "kissra/impl/iter/cache_latest_iter.hpp"
 #include "kissra/impl/iter/iter_base.hpp"
 #include "kissra/misc/functional.hpp"
 
@@ -80,11 +81,9 @@ private:
 
     constexpr void ff_self() {
         if (!std::exchange(this->dropped, true)) {
-            for (auto item = this->base_iter.front(); item; item = this->base_iter.nth(1)) {
-                if (!kissra::invoke(this->fn.inst, std::forward_like<reference>(*item))) {
-                    break;
-                }
-            }
+            impl::skip_until(this->base_iter, [&](auto& item) {
+                return !kissra::invoke(this->fn.inst, std::forward_like<reference>(item));
+            });
         }
     }
 
@@ -98,7 +97,8 @@ struct drop_while_mixin {
     template <typename TSelf, typename TFn, typename DeferInstantiation = void>
     constexpr auto drop_while(this TSelf&& self, TFn fn) {
         return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
-            return drop_while_iter<std::remove_cvref_t<TSelf>, TFn, TMixins...>{ std::forward<TSelf>(self), fn };
+            using base_iter_t = impl::auto_cache_latest_t<TSelf, TMixins...>;
+            return drop_while_iter<base_iter_t, TFn, TMixins...>{ impl::auto_cache_latest<TMixins...>(std::forward<TSelf>(self)), fn };
         });
     }
 };
@@ -112,8 +112,8 @@ struct drop_while_compose : public builtin_mixins_compose<TBaseCompose>, public
 
     template <template <typename> typename... TMixins, typename TSelf, kissra::iterator UBaseIter>
     constexpr auto make_iter(this TSelf&& self, UBaseIter&& base_iter) {
-        return drop_while_iter<std::remove_cvref_t<UBaseIter>, TFn, TMixins...>{
-            std::forward<UBaseIter>(base_iter),
+        return drop_while_iter<impl::auto_cache_latest_t<UBaseIter, TMixins...>, TFn, TMixins...>{
+            impl::auto_cache_latest<TMixins...>(std::forward<UBaseIter>(base_iter)),
             std::forward<TSelf>(self).fn.inst,
         };
     }
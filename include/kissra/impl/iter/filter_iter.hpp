@@ -1,5 +1,6 @@
 #pragma once
 #include "kissra/impl/compose.hpp"
+#include "kissra/impl/iter/cache_latest_iter.hpp"
 #include "kissra/impl/iter/iter_base.hpp"
 #include "kissra/misc/functional.hpp"
 
@@ -55,38 +56,18 @@ public:
     }
 
     [[nodiscard]] constexpr result_t nth(std::size_t n) {
-        for (auto item = this->base_iter.front(); item; item = this->base_iter.nth(1)) {
-            if (kissra::invoke(this->fn.inst, std::forward_like<reference>(*item))) {
-                if (n-- == 0) {
-                    return item;
-                }
-            }
-        }
-        return {};
+        return impl::peek_until(this->base_iter, [&](auto& item) { return this->passes(item) && n-- == 0; });
     }
 
     [[nodiscard]] constexpr result_t nth_back(std::size_t n)
         requires is_common && is_bidir
     {
-        for (auto item = this->base_iter.back(); item; item = this->base_iter.nth_back(1)) {
-            if (kissra::invoke(this->fn.inst, std::forward_like<reference>(*item))) {
-                if (n-- == 0) {
-                    return item;
-                }
-            }
-        }
-        return {};
+        return impl::peek_until<true>(this->base_iter, [&](auto& item) { return this->passes(item) && n-- == 0; });
     }
 
     constexpr std::size_t advance(std::size_t n) {
         std::size_t offset = 0;
-        for (auto item = this->base_iter.front(); item; item = this->base_iter.nth(1)) {
-            if (kissra::invoke(this->fn.inst, std::forward_like<reference>(*item))) {
-                if (offset++ == n) {
-                    break;
-                }
-            }
-        }
+        impl::skip_until(this->base_iter, [&](auto& item) { return this->passes(item) && offset++ == n; });
         return offset;
     }
 
@@ -94,16 +75,20 @@ public:
         requires is_common && is_bidir
     {
         std::size_t offset = 0;
-        for (auto item = this->base_iter.back(); item; item = this->base_iter.nth_back(1)) {
-            if (kissra::invoke(this->fn.inst, std::forward_like<reference>(*item))) {
-                if (offset++ == n) {
-                    break;
-                }
-            }
-        }
+        impl::skip_until<true>(this->base_iter, [&](auto& item) { return this->passes(item) && offset++ == n; });
         return offset;
     }
 
+    constexpr auto& filter_fn() {
+        return this->fn.inst;
+    }
+
+private:
+    template <typename T>
+    constexpr bool passes(T& item) {
+        return kissra::invoke(this->fn.inst, std::forward_like<reference>(item));
+    }
+
 private:
     // TODO: MSVC [[no_unique_address]] (EBO basically) is broken. Test MSVC specific intrinsics (iirc there is msvc specific attribute as well) to fix that
     [[no_unique_address]] functor_ebo<TFn, TBaseIter> fn;
@@ -114,7 +99,8 @@ struct filter_mixin {
     template <typename TSelf, typename TFn, typename DeferInstantiation = void>
     constexpr auto filter(this TSelf&& self, TFn fn) {
         return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
-            return filter_iter<std::remove_cvref_t<TSelf>, TFn, TMixins...>{ std::forward<TSelf>(self), fn };
+            using base_iter_t = impl::auto_cache_latest_t<TSelf, TMixins...>;
+            return filter_iter<base_iter_t, TFn, TMixins...>{ impl::auto_cache_latest<TMixins...>(std::forward<TSelf>(self)), fn };
         });
     }
 };
@@ -133,8 +119,8 @@ struct filter_compose : public builtin_mixins_compose<TBaseCompose>, public TMix
 
     template <template <typename> typename... TMixins, typename TSelf, kissra::iterator UBaseIter>
     constexpr auto make_iter(this TSelf&& self, UBaseIter&& base_iter) {
-        return filter_iter<std::remove_cvref_t<UBaseIter>, TFn, TMixins...>{
-            std::forward<UBaseIter>(base_iter),
+        return filter_iter<impl::auto_cache_latest_t<UBaseIter, TMixins...>, TFn, TMixins...>{
+            impl::auto_cache_latest<TMixins...>(std::forward<UBaseIter>(base_iter)),
             std::forward<TSelf>(self).fn.inst,
         };
     }
@@ -0,0 +1,342 @@
+#pragma once
+#include "kissra/impl/algo/contiguous.hpp"
+#include "kissra/impl/compose.hpp"
+#include "kissra/impl/into_iter.hpp"
+#include "kissra/impl/iter/iter_base.hpp"
+#include "kissra/misc/flat_hash_map.hpp"
+#include "kissra/misc/functional.hpp"
+#include "kissra/misc/utility.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+/* What `hash_join` yields for a probe item. */
+enum class join_kind {
+    /* A `(probe item, build item)` tuple per build item with the same key. */
+    inner,
+    /* The probe item if there is a build item with the same key. */
+    left_semi,
+    /* The probe item if there is no build item with the same key. */
+    left_anti,
+};
+
+namespace impl {
+/**
+ * Build side of a hash join: items grouped by key (stored contiguously per key, in the original order) and a
+ * `flat_hash_map` from a key to its group. Lvalue items are referred to, anything else is stored by value.
+ */
+template <typename TBuildIter, typename TBuildKey>
+class join_table {
+public:
+    using build_reference = kissra::iter_reference_t<TBuildIter>;
+    using key_type = std::remove_cvref_t<kissra::invoke_result_t<TBuildKey&, build_reference&>>;
+
+    static constexpr bool by_reference = std::is_lvalue_reference_v<build_reference>;
+
+    using row_type = std::conditional_t<by_reference, std::remove_reference_t<build_reference>*, std::remove_cvref_t<build_reference>>;
+    using reference = std::conditional_t<by_reference, build_reference, row_type&>;
+
+    constexpr join_table(TBuildIter iter, TBuildKey& build_key) {
+        std::vector<row_type> items;
+        std::vector<std::size_t> group_of;
+        if constexpr (kissra::is_sized_v<TBuildIter>) {
+            items.reserve(iter.size());
+            group_of.reserve(iter.size());
+            this->groups.reserve(iter.size());
+        }
+
+        while (auto item = iter.next()) {
+            auto&& key = kissra::invoke(build_key, *item);
+            const auto hash = this->groups.hash_of(key);
+            const std::size_t new_group = this->groups.size();
+            group_of.push_back(this->groups.try_emplace_hashed(hash, KISSRA_FWD(key), new_group).first.second);
+            if constexpr (by_reference) {
+                items.push_back(std::addressof(*item));
+            } else {
+                items.emplace_back(std::forward_like<build_reference>(*item));
+            }
+        }
+
+        /* Counting sort of the items by group: every group ends up as a contiguous slice of `rows`. */
+        this->offsets.assign(this->groups.size() + 1, 0);
+        for (const auto group : group_of) {
+            ++this->offsets[group + 1];
+        }
+        for (std::size_t group = 0; group != this->groups.size(); ++group) {
+            this->offsets[group + 1] += this->offsets[group];
+        }
+        std::vector<std::size_t> order(items.size());
+        std::vector<std::size_t> cursors(this->offsets.begin(), this->offsets.end() - 1);
+        for (std::size_t i = 0; i != group_of.size(); ++i) {
+            order[cursors[group_of[i]]++] = i;
+        }
+        this->rows.reserve(items.size());
+        for (const auto i : order) {
+            this->rows.push_back(std::move(items[i]));
+        }
+    }
+
+    constexpr std::uint64_t hash_of(const key_type& key) const {
+        return this->groups.hash_of(key);
+    }
+
+    /* `[first, last)` positions of the rows with the `hash_of`-hashed `key` (an empty range if there are none). */
+    constexpr std::pair<std::size_t, std::size_t> find_hashed(std::uint64_t hash, const key_type& key) const {
+        if (const auto* entry = this->groups.find_hashed(hash, key)) {
+            return { this->offsets[entry->second], this->offsets[entry->second + 1] };
+        }
+        return { 0, 0 };
+    }
+
+    constexpr reference row(std::size_t position) {
+        if constexpr (by_reference) {
+            return *this->rows[position];
+        } else {
+            return this->rows[position];
+        }
+    }
+
+private:
+    kissra::flat_hash_map<key_type, std::size_t> groups;
+    /* Rows of the group `g` are `rows[offsets[g]..offsets[g + 1]]`. */
+    std::vector<std::size_t> offsets;
+    std::vector<row_type> rows;
+};
+
+/* Number of probe keys hashed at once (ahead of the lookups) if the probe items are read straight from memory. */
+inline constexpr std::size_t join_hash_batch = 64;
+} // namespace impl
+
+/**
+ * Probe side of a hash join against a `join_table` built (once, upfront) out of the build side. Over contiguous probe
+ * items (under `members<I>()` projections at most) keys are hashed in batches: a tight loop over the upcoming items
+ * which doesn't wait for the table lookups.
+ */
+template <typename TBaseIter, typename TTable, typename TProbeKey, join_kind Kind, template <typename> typename... TMixins>
+    requires kissra::regular_invocable<TProbeKey, typename TBaseIter::reference&>
+class hash_join_iter : public iter_base<TBaseIter>, public builtin_mixins<TBaseIter>, public TMixins<TBaseIter>... {
+    /* A probe item is yielded once per match: rvalue ones are not moved from but referred to as lvalues. */
+    using probe_reference = std::conditional_t<std::is_rvalue_reference_v<typename TBaseIter::reference>,
+        std::remove_reference_t<typename TBaseIter::reference>&,
+        typename TBaseIter::reference>;
+
+public:
+    using value_type = std::conditional_t<Kind == join_kind::inner,
+        std::tuple<probe_reference, typename TTable::reference>,
+        typename TBaseIter::value_type>;
+    using reference = std::conditional_t<Kind == join_kind::inner, value_type, typename TBaseIter::reference>;
+    using result_t = std::conditional_t<Kind == join_kind::inner, kissra::optional<reference>, typename TBaseIter::result_t>;
+    using cursor_t = typename TBaseIter::cursor_t;
+    using sentinel_t = typename TBaseIter::sentinel_t;
+
+    static constexpr bool is_sized = false;
+    static constexpr bool is_common = false;
+    static constexpr bool is_forward = TBaseIter::is_forward;
+    static constexpr bool is_bidir = false;
+    static constexpr bool is_random = false;
+    static constexpr bool is_contiguous = false;
+    static constexpr bool is_monotonic = false;
+
+    template <typename UBaseIter>
+    constexpr hash_join_iter(UBaseIter&& base_iter, TTable table, TProbeKey probe_key)
+        : iter_base<TBaseIter>(std::forward<UBaseIter>(base_iter))
+        , table(std::move(table))
+        , probe_key(probe_key) {}
+
+    [[nodiscard]] constexpr result_t next() {
+        if (!this->settle()) {
+            return {};
+        }
+        if constexpr (Kind == join_kind::inner) {
+            auto result = this->current();
+            --this->remaining;
+            return result;
+        } else {
+            this->remaining = 0;
+            return std::move(this->probe);
+        }
+    }
+
+    /* Items are skipped over (the current one is not consumed). */
+    [[nodiscard]] constexpr result_t nth(std::size_t n) {
+        this->advance(n);
+        if (!this->settle()) {
+            return {};
+        }
+        if constexpr (Kind == join_kind::inner) {
+            return this->current();
+        } else {
+            return this->probe;
+        }
+    }
+
+    constexpr std::size_t advance(std::size_t n) {
+        std::size_t offset = 0;
+        while (offset != n && this->settle()) {
+            const auto step = std::min(n - offset, this->remaining);
+            this->remaining -= step;
+            offset += step;
+        }
+        return offset;
+    }
+
+private:
+    /* User projections would run twice per item (once ahead of `next()`), those are not batched. */
+    static constexpr bool batched =
+        impl::is_contiguous_source<TBaseIter>::value && impl::is_pure_contiguous_source<TBaseIter>::value;
+
+    /* Make the probe item with some items left to yield (if any) the current one. */
+    constexpr bool settle() {
+        while (this->remaining == 0) {
+            if constexpr (batched) {
+                if (this->hashed_pos == this->hashed_count) {
+                    this->hash_ahead();
+                }
+            }
+            this->probe = this->base_iter.next();
+            if (!this->probe) {
+                return false;
+            }
+            const typename TTable::key_type& key = kissra::invoke(this->probe_key.inst, *this->probe);
+            std::uint64_t hash;
+            if constexpr (batched) {
+                hash = this->hashes[this->hashed_pos++];
+            } else {
+                hash = this->table.hash_of(key);
+            }
+            const auto [first, last] = this->table.find_hashed(hash, key);
+            this->matches_end = last;
+
+            if constexpr (Kind == join_kind::inner) {
+                this->remaining = last - first;
+            } else {
+                this->remaining = (first == last) == (Kind == join_kind::left_anti);
+            }
+        }
+        return true;
+    }
+
+    constexpr reference current() {
+        return reference{ static_cast<probe_reference>(*this->probe), this->table.row(this->matches_end - this->remaining) };
+    }
+
+    /* Hash the keys of the upcoming (up to `join_hash_batch`) probe items in one go, the iterator is NOT advanced. */
+    constexpr void hash_ahead() {
+        auto [items, proj] = impl::contiguous_source(this->base_iter);
+        this->hashed_count = std::min(items.size(), impl::join_hash_batch);
+        this->hashed_pos = 0;
+        for (std::size_t i = 0; i != this->hashed_count; ++i) {
+            auto&& item = kissra::invoke(proj, items[i]);
+            this->hashes[i] = this->table.hash_of(kissra::invoke(this->probe_key.inst, item));
+        }
+    }
+
+    struct no_hashes {};
+
+    TTable table;
+    [[no_unique_address]] functor_ebo<TProbeKey, TBaseIter> probe_key;
+    typename TBaseIter::result_t probe;
+    /* Matches of the current probe item not yielded yet are the rows `[matches_end - remaining, matches_end)`. */
+    std::size_t matches_end = 0;
+    std::size_t remaining = 0;
+    [[no_unique_address]] std::conditional_t<batched, std::array<std::uint64_t, impl::join_hash_batch>, no_hashes> hashes{};
+    std::size_t hashed_pos = 0;
+    std::size_t hashed_count = 0;
+};
+
+namespace impl {
+template <typename DeferInstantiation, typename TBuild, typename TBuildKey>
+constexpr auto make_join_table(TBuild&& build, TBuildKey build_key) {
+    using build_iter_t = std::remove_cvref_t<decltype(impl::into_kissra_iter<DeferInstantiation>(KISSRA_FWD(build)))>;
+    return impl::join_table<build_iter_t, TBuildKey>{ impl::into_kissra_iter<DeferInstantiation>(KISSRA_FWD(build)), build_key };
+}
+} // namespace impl
+
+template <typename Tag>
+struct hash_join_mixin {
+    /**
+     * Join against `build` items with equal keys (`probe_key(probe item) == build_key(build item)`), see `join_kind`.
+     * The build side is consumed right away into a hash table (build items are stored by value unless those are
+     * lvalues), probe items are streamed in their original order, matches of a probe item in the build side order.
+     */
+    template <join_kind Kind = join_kind::inner,
+        typename TSelf,
+        kissra::iterator_compatible TBuild,
+        typename TBuildKey,
+        typename TProbeKey,
+        typename DeferInstantiation = void>
+    constexpr auto hash_join(this TSelf&& self, TBuild&& build, TBuildKey build_key, TProbeKey probe_key) {
+        auto table = impl::make_join_table<DeferInstantiation>(KISSRA_FWD(build), build_key);
+        return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+            return hash_join_iter<std::remove_cvref_t<TSelf>, decltype(table), TProbeKey, Kind, TMixins...>{
+                std::forward<TSelf>(self),
+                std::move(table),
+                probe_key,
+            };
+        });
+    }
+};
+
+namespace compo {
+template <typename TBaseCompose, typename TBuildIter, typename TBuildKey, typename TProbeKey, join_kind Kind, template <typename> typename... TMixinsCompose>
+struct hash_join_compose : public builtin_mixins_compose<TBaseCompose>, public TMixinsCompose<TBaseCompose>... {
+    [[no_unique_address]] TBaseCompose base_comp;
+    TBuildIter build;
+    [[no_unique_address]] functor_ebo<TBuildKey, TBaseCompose> build_key;
+    [[no_unique_address]] functor_ebo<TProbeKey, TBaseCompose> probe_key;
+
+    /* The table is built out of (a copy of) the build side every time the composition is applied. */
+    template <template <typename> typename... TMixins, typename TSelf, kissra::iterator UBaseIter>
+    constexpr auto make_iter(this TSelf&& self, UBaseIter&& base_iter) {
+        TBuildKey build_key = self.build_key.inst;
+        impl::join_table<TBuildIter, TBuildKey> table{ kissra::forward_member<TSelf, TBuildIter>(self.build), build_key };
+        return hash_join_iter<std::remove_cvref_t<UBaseIter>, decltype(table), TProbeKey, Kind, TMixins...>{
+            std::forward<UBaseIter>(base_iter),
+            std::move(table),
+            std::forward<TSelf>(self).probe_key.inst,
+        };
+    }
+};
+
+template <typename Tag>
+struct hash_join_compose_mixin {
+    template <join_kind Kind = join_kind::inner,
+        typename TSelf,
+        kissra::iterator_compatible TBuild,
+        typename TBuildKey,
+        typename TProbeKey,
+        typename DeferInstantiation = void>
+    constexpr auto hash_join(this TSelf&& self, TBuild&& build, TBuildKey build_key, TProbeKey probe_key) {
+        using build_iter_t = std::remove_cvref_t<decltype(impl::into_kissra_iter<DeferInstantiation>(KISSRA_FWD(build)))>;
+        return with_custom_mixins_compose<DeferInstantiation>([&]<template <typename> typename... TMixinsCompose> {
+            return hash_join_compose<std::remove_cvref_t<TSelf>, build_iter_t, TBuildKey, TProbeKey, Kind, TMixinsCompose...>{
+                .base_comp = std::forward<TSelf>(self),
+                .build = impl::into_kissra_iter<DeferInstantiation>(KISSRA_FWD(build)),
+                .build_key = build_key,
+                .probe_key = probe_key,
+            };
+        });
+    }
+};
+
+template <join_kind Kind = join_kind::inner,
+    kissra::iterator_compatible TBuild,
+    typename TBuildKey,
+    typename TProbeKey,
+    typename DeferInstantiation = void>
+constexpr auto hash_join(TBuild&& build, TBuildKey build_key, TProbeKey probe_key) {
+    return compose<DeferInstantiation>().template hash_join<Kind>(KISSRA_FWD(build), build_key, probe_key);
+}
+} // namespace compo
+} // namespace kissra
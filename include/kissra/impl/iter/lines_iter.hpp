@@ -0,0 +1,131 @@
+#pragma once
+#include "kissra/impl/custom_mixins.hpp"
+#include "kissra/impl/iter/iter_base.hpp"
+#include "kissra/impl/iter/split_iter.hpp"
+#include "kissra/misc/mapped_file.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/* `std::getline` semantics: a trailing '\n' terminates the last line rather than starting an empty one. */
+template <template <typename> typename... TMixins>
+constexpr auto make_lines_iter(std::string_view text) {
+    const auto body = text.ends_with('\n') ? text.substr(0, text.size() - 1) : text;
+
+    auto iter = impl::make_split_iter<TMixins...>(body, '\n');
+    /* "\n" is a single empty line whereas `split` would yield nothing out of an empty `body`. */
+    iter.underlying_sentinel_override(text.empty() ? 0 : body.size() + 1);
+    return iter;
+}
+} // namespace impl
+
+/* Lines (without '\n') of contiguous characters as `std::string_view`s. */
+template <typename TRng, typename DeferInstantiation = void>
+    requires kissra::char_range<TRng> && (std::is_lvalue_reference_v<TRng> || std::ranges::borrowed_range<TRng>)
+constexpr auto lines(TRng&& rng) {
+    return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+        return impl::make_lines_iter<TMixins...>(std::string_view{ std::ranges::data(rng), std::ranges::size(rng) });
+    });
+}
+
+#if KISSRA_HAS_MMAP
+/**
+ * Lines of a memory mapped file, yields `std::string_view`s pointing straight into the mapping. Bidirectional, so that
+ * `reverse().take(n)` reads the tail of a file without touching the rest of it.
+ * `mmap_lines(path)` owns the mapping (shared between copies, e.g. `chunk`s) and releases it along with the last copy:
+ * lines collected out of it (`collect()` and such) dangle once the iterator is gone. Map the file with `mapped_file`
+ * and use `mmap_lines(file)` for lines which have to stay valid as long as the `mapped_file` does.
+ */
+template <template <typename> typename... TMixins>
+class mmap_lines_iter : public iter_base<split_iter<char, TMixins...>>,
+                        public builtin_mixins<mapped_file>,
+                        public TMixins<mapped_file>... {
+    using base_iter_t = split_iter<char, TMixins...>;
+
+public:
+    using value_type = typename base_iter_t::value_type;
+    using reference = typename base_iter_t::reference;
+    using result_t = typename base_iter_t::result_t;
+    using cursor_t = typename base_iter_t::cursor_t;
+    using sentinel_t = typename base_iter_t::sentinel_t;
+
+    static constexpr bool is_sized = base_iter_t::is_sized;
+    static constexpr bool is_common = base_iter_t::is_common;
+    static constexpr bool is_forward = base_iter_t::is_forward;
+    static constexpr bool is_bidir = base_iter_t::is_bidir;
+    static constexpr bool is_random = base_iter_t::is_random;
+    static constexpr bool is_contiguous = base_iter_t::is_contiguous;
+    static constexpr bool is_monotonic = base_iter_t::is_monotonic;
+
+    explicit mmap_lines_iter(std::shared_ptr<const mapped_file> file)
+        : iter_base<base_iter_t>(impl::make_lines_iter<TMixins...>(file->view()))
+        , file(std::move(file)) {}
+
+    [[nodiscard]] constexpr result_t next() {
+        return this->base_iter.next();
+    }
+
+    [[nodiscard]] constexpr result_t next_back() {
+        return this->base_iter.next_back();
+    }
+
+    [[nodiscard]] constexpr result_t nth(std::size_t n) {
+        return this->base_iter.nth(n);
+    }
+
+    [[nodiscard]] constexpr result_t nth_back(std::size_t n) {
+        return this->base_iter.nth_back(n);
+    }
+
+    constexpr std::size_t advance(std::size_t n) {
+        return this->base_iter.advance(n);
+    }
+
+    constexpr std::size_t advance_back(std::size_t n) {
+        return this->base_iter.advance_back(n);
+    }
+
+    /* Raw bytes of the remaining lines, '\n's included (for algorithms working on bytes rather than on lines). */
+    std::span<const char> bytes() const noexcept {
+        const auto first = this->base_iter.underlying_cursor();
+        /* The sentinel of the last line is past the end of a file which doesn't end with '\n'. */
+        const auto last = std::min(this->base_iter.underlying_sentinel(), this->file->size());
+        return this->file->bytes().subspan(first, last - first);
+    }
+
+private:
+    std::shared_ptr<const mapped_file> file;
+};
+
+template <typename DeferInstantiation = void>
+auto mmap_lines(const std::filesystem::path& path) {
+    return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+        return mmap_lines_iter<TMixins...>{ std::make_shared<const mapped_file>(path) };
+    });
+}
+
+/* Lines of a mapping owned by the caller: `file` has to outlive both the iterator and the lines. */
+template <typename DeferInstantiation = void>
+auto mmap_lines(const mapped_file& file) {
+    return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+        /* Non-owning (aliasing) pointer. */
+        return mmap_lines_iter<TMixins...>{ std::shared_ptr<const mapped_file>{ std::shared_ptr<void>{}, &file } };
+    });
+}
+
+template <typename DeferInstantiation = void>
+auto mmap_lines(const mapped_file&& file) = delete;
+#endif
+} // namespace kissra
\ No newline at end of file
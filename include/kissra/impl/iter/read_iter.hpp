@@ -0,0 +1,180 @@
+#pragma once
+#include "kissra/impl/custom_mixins.hpp"
+#include "kissra/misc/fd_reader.hpp"
+#include "kissra/misc/optional.hpp"
+#include "kissra/misc/search.hpp"
+
+#ifndef KISSRA_MODULE
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#endif
+
+#if KISSRA_HAS_POSIX_READ
+KISSRA_EXPORT()
+namespace kissra {
+/**
+ * Records of a file descriptor separated by `delimiter` (the delimiter itself is not a part of a record, a trailing
+ * delimiter doesn't start an empty record). Input-only: bytes are read lazily, so `take`/`find` stop reading as soon as
+ * they are done. Yielded `std::string_view`s point into `fd_reader` buffers (see `fd_reader` for their lifetime).
+ */
+template <template <typename> typename... TMixins>
+class read_records_iter : public builtin_mixins<fd_reader>, public TMixins<fd_reader>... {
+public:
+    using value_type = std::string_view;
+    using reference = std::string_view;
+    using result_t = kissra::optional<reference>;
+    /* Offset in the stream (there are no underlying cursor/sentinel overrides - the stream can't be rewound). */
+    using cursor_t = std::size_t;
+    using sentinel_t = std::size_t;
+
+    static constexpr bool is_sized = false;
+    static constexpr bool is_common = false;
+    static constexpr bool is_forward = false;
+    static constexpr bool is_bidir = false;
+    static constexpr bool is_random = false;
+    static constexpr bool is_contiguous = false;
+    static constexpr bool is_monotonic = true;
+
+    read_records_iter(int fd, char delimiter, std::size_t block_size)
+        : reader(fd, block_size)
+        , delimiter(delimiter) {}
+
+    [[nodiscard]] result_t next() {
+        const auto [record, record_size] = this->peek();
+        if (!record) {
+            return {};
+        }
+        this->reader.consume(record_size);
+        return record;
+    }
+
+    [[nodiscard]] result_t nth(std::size_t n) {
+        this->advance(n);
+        return this->peek().first;
+    }
+
+    std::size_t advance(std::size_t n) {
+        std::size_t offset = 0;
+        while (offset != n) {
+            const auto [record, record_size] = this->peek();
+            if (!record) {
+                break;
+            }
+            this->reader.consume(record_size);
+            ++offset;
+        }
+        return offset;
+    }
+
+private:
+    /* Returns the next record without consuming it & its size including the delimiter. */
+    std::pair<result_t, std::size_t> peek() {
+        std::size_t scanned = 0;
+        while (true) {
+            const auto data = this->reader.buffered();
+            const char* first = data.data();
+            if (const char* found = impl::find_byte(first + scanned, first + data.size(), this->delimiter)) {
+                const auto size = std::size_t(found - first);
+                return { data.substr(0, size), size + 1 };
+            }
+            /* The record straddles the end of the buffer. Carried over bytes are already scanned. */
+            scanned = data.size();
+            if (!this->reader.refill()) {
+                const auto rest = this->reader.buffered();
+                if (rest.empty()) {
+                    return { result_t{}, 0 };
+                }
+                return { rest, rest.size() };
+            }
+        }
+    }
+
+private:
+    fd_reader reader;
+    char delimiter;
+};
+
+/**
+ * Blocks of `block_size` bytes (the last one may be shorter) of a file descriptor. Input-only, reads lazily.
+ * Yielded `std::string_view`s point into `fd_reader` buffers (see `fd_reader` for their lifetime).
+ */
+template <template <typename> typename... TMixins>
+class read_chunks_iter : public builtin_mixins<fd_reader>, public TMixins<fd_reader>... {
+public:
+    using value_type = std::string_view;
+    using reference = std::string_view;
+    using result_t = kissra::optional<reference>;
+    using cursor_t = std::size_t;
+    using sentinel_t = std::size_t;
+
+    static constexpr bool is_sized = false;
+    static constexpr bool is_common = false;
+    static constexpr bool is_forward = false;
+    static constexpr bool is_bidir = false;
+    static constexpr bool is_random = false;
+    static constexpr bool is_contiguous = false;
+    static constexpr bool is_monotonic = true;
+
+    read_chunks_iter(int fd, std::size_t block_size)
+        : reader(fd, block_size)
+        , block_size(block_size) {}
+
+    [[nodiscard]] result_t next() {
+        const auto block = this->peek();
+        if (block) {
+            this->reader.consume(block->size());
+        }
+        return block;
+    }
+
+    [[nodiscard]] result_t nth(std::size_t n) {
+        this->advance(n);
+        return this->peek();
+    }
+
+    std::size_t advance(std::size_t n) {
+        std::size_t offset = 0;
+        while (offset != n) {
+            const auto block = this->peek();
+            if (!block) {
+                break;
+            }
+            this->reader.consume(block->size());
+            ++offset;
+        }
+        return offset;
+    }
+
+private:
+    result_t peek() {
+        if (this->reader.buffered().size() < this->block_size) {
+            this->reader.refill(this->block_size);
+        }
+        const auto data = this->reader.buffered();
+        if (data.empty()) {
+            return {};
+        }
+        return data.substr(0, this->block_size);
+    }
+
+private:
+    fd_reader reader;
+    std::size_t block_size;
+};
+
+template <typename DeferInstantiation = void>
+auto read_records(int fd, char delimiter = '\n', std::size_t block_size = 1uz << 20) {
+    return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+        return read_records_iter<TMixins...>{ fd, delimiter, block_size };
+    });
+}
+
+template <typename DeferInstantiation = void>
+auto read_chunks(int fd, std::size_t block_size = 1uz << 20) {
+    return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+        return read_chunks_iter<TMixins...>{ fd, block_size };
+    });
+}
+} // namespace kissra
+#endif
\ No newline at end of file
@@ -36,7 +36,7 @@ public:
     static constexpr bool is_forward = TBaseIter::is_forward;
     static constexpr bool is_bidir = TBaseIter::is_bidir;
     static constexpr bool is_random = TBaseIter::is_random;
-    static constexpr bool is_contiguous = !TBaseIter::is_contiguous;
+    static constexpr bool is_contiguous = false;
     static constexpr bool is_monotonic = TBaseIter::is_monotonic;
 
     template <kissra::not_the_same<reverse_iter> UBaseIter>
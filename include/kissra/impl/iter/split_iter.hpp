@@ -0,0 +1,277 @@
+#pragma once
+#include "kissra/impl/compose.hpp"
+#include "kissra/impl/custom_mixins.hpp"
+#include "kissra/misc/optional.hpp"
+#include "kissra/misc/search.hpp"
+
+#ifndef KISSRA_MODULE
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+template <typename T>
+concept split_delimiter = std::same_as<T, char> || std::same_as<T, std::string_view>;
+
+/**
+ * Split contiguous characters by `TDelim` (either a single `char` or a `std::string_view`) into `std::string_view`
+ * tokens without copying anything. Follows `std::views::split` semantics: empty input yields no tokens, a trailing
+ * delimiter yields a trailing empty token, an empty delimiter yields single-character tokens.
+ *
+ * Cursor and sentinel are offsets of token boundaries: the token starting at `cursor` ends at the next delimiter and
+ * the last token ends at `sentinel - delimiter size` (as if the text was terminated with one more delimiter).
+ * This way cursor and sentinel are interchangeable which is what `chunk_iter` expects from `underlying_*_override`.
+ * Note: for multi-character delimiters with self-overlapping occurrences (e.g. "aa" in "aaa") forward and backward
+ * tokenization may differ (same as Rust's `split`).
+ */
+template <split_delimiter TDelim, template <typename> typename... TMixins>
+class split_iter : public builtin_mixins<TDelim>, public TMixins<TDelim>... {
+public:
+    using value_type = std::string_view;
+    using reference = std::string_view;
+    using result_t = kissra::optional<reference>;
+    using cursor_t = std::size_t;
+    using sentinel_t = std::size_t;
+
+    static constexpr bool is_sized = false;
+    static constexpr bool is_common = true;
+    static constexpr bool is_forward = true;
+    static constexpr bool is_bidir = true;
+    static constexpr bool is_random = false;
+    static constexpr bool is_contiguous = false;
+    static constexpr bool is_monotonic = true;
+
+    constexpr split_iter(std::string_view text, TDelim delim)
+        : text(text)
+        , delim(delim)
+        , cursor(0)
+        , sentinel(text.empty() ? 0 : text.size() + delim_size()) {}
+
+    [[nodiscard]] constexpr result_t next() {
+        if (this->cursor == this->sentinel) {
+            return {};
+        }
+        const auto [token, next_cursor] = this->find_front();
+        this->cursor = next_cursor;
+        return token;
+    }
+
+    [[nodiscard]] constexpr result_t next_back() {
+        if (this->cursor == this->sentinel) {
+            return {};
+        }
+        const auto [token, next_sentinel] = this->find_back();
+        this->sentinel = next_sentinel;
+        return token;
+    }
+
+    [[nodiscard]] constexpr result_t nth(std::size_t n) {
+        this->advance(n);
+
+        if (this->cursor != this->sentinel) {
+            return this->find_front().first;
+        }
+        return {};
+    }
+
+    [[nodiscard]] constexpr result_t nth_back(std::size_t n) {
+        this->advance_back(n);
+
+        if (this->cursor != this->sentinel) {
+            return this->find_back().first;
+        }
+        return {};
+    }
+
+    constexpr std::size_t advance(std::size_t n) {
+        std::size_t offset = 0;
+        while (offset != n && this->cursor != this->sentinel) {
+            this->cursor = this->find_front().second;
+            ++offset;
+        }
+        return offset;
+    }
+
+    constexpr std::size_t advance_back(std::size_t n) {
+        std::size_t offset = 0;
+        while (offset != n && this->cursor != this->sentinel) {
+            this->sentinel = this->find_back().second;
+            ++offset;
+        }
+        return offset;
+    }
+
+
+    constexpr auto underlying_cursor() const {
+        return this->cursor;
+    }
+
+    constexpr auto underlying_sentinel() const {
+        return this->sentinel;
+    }
+
+    constexpr void underlying_cursor_override(cursor_t cursor) {
+        this->cursor = cursor;
+    }
+
+    constexpr void underlying_sentinel_override(sentinel_t sentinel) {
+        this->sentinel = sentinel;
+    }
+
+private:
+    constexpr std::size_t delim_size() const {
+        if constexpr (std::same_as<TDelim, char>) {
+            return 1;
+        } else {
+            return this->delim.size();
+        }
+    }
+
+    /* Returns the first remaining token & the offset of the token which follows it. */
+    constexpr std::pair<std::string_view, std::size_t> find_front() const {
+        const auto last_end = this->sentinel - this->delim_size();
+
+        if constexpr (std::same_as<TDelim, char>) {
+            const char* first = this->text.data() + this->cursor;
+            const char* last = this->text.data() + last_end;
+            if (const char* found = impl::find_byte(first, last, this->delim)) {
+                const auto pos = std::size_t(found - this->text.data());
+                return { this->token(this->cursor, pos), pos + 1 };
+            }
+        } else {
+            if (this->delim.empty()) {
+                return { this->token(this->cursor, this->cursor + 1), this->cursor + 1 };
+            }
+            const auto pos = this->text.substr(0, last_end).find(this->delim, this->cursor);
+            if (pos != std::string_view::npos) {
+                return { this->token(this->cursor, pos), pos + this->delim.size() };
+            }
+        }
+        return { this->token(this->cursor, last_end), this->sentinel };
+    }
+
+    /* Returns the last remaining token & the offset right past the delimiter which precedes it. */
+    constexpr std::pair<std::string_view, std::size_t> find_back() const {
+        const auto last_end = this->sentinel - this->delim_size();
+
+        if constexpr (std::same_as<TDelim, char>) {
+            const char* first = this->text.data() + this->cursor;
+            const char* last = this->text.data() + last_end;
+            if (const char* found = impl::find_last_byte(first, last, this->delim)) {
+                const auto pos = std::size_t(found - this->text.data());
+                return { this->token(pos + 1, last_end), pos + 1 };
+            }
+        } else {
+            if (this->delim.empty()) {
+                return { this->token(last_end - 1, last_end), last_end - 1 };
+            }
+            const auto remaining = this->text.substr(this->cursor, last_end - this->cursor);
+            if (remaining.size() >= this->delim.size()) {
+                const auto pos = remaining.rfind(this->delim);
+                if (pos != std::string_view::npos) {
+                    const auto token_begin = this->cursor + pos + this->delim.size();
+                    return { this->token(token_begin, last_end), token_begin };
+                }
+            }
+        }
+        return { this->token(this->cursor, last_end), this->cursor };
+    }
+
+    constexpr std::string_view token(std::size_t begin, std::size_t end) const {
+        return this->text.substr(begin, end - begin);
+    }
+
+private:
+    std::string_view text;
+    TDelim delim;
+    std::size_t cursor;
+    std::size_t sentinel;
+};
+
+namespace impl {
+template <template <typename> typename... TMixins, split_delimiter TDelim>
+constexpr auto make_split_iter(std::string_view text, TDelim delim) {
+    return split_iter<TDelim, TMixins...>{ text, delim };
+}
+
+template <template <typename> typename... TMixins, kissra::char_iterator TIter, split_delimiter TDelim>
+constexpr auto make_split_iter(TIter& iter, TDelim delim) {
+    /* Fast-forward underlying cursor (e.g. see `drop_iter`) so that it is safe to use it as a raw pointer. */
+    iter.advance(0);
+    return impl::make_split_iter<TMixins...>(std::string_view{ std::to_address(iter.underlying_cursor()), iter.size() }, delim);
+}
+
+template <split_delimiter TDelim>
+constexpr auto as_split_delimiter(TDelim delim) {
+    return delim;
+}
+
+constexpr auto as_split_delimiter(const char* delim) {
+    return std::string_view{ delim };
+}
+} // namespace impl
+
+template <typename Tag>
+struct split_mixin {
+    template <kissra::mut TSelf, typename TDelim, typename DeferInstantiation = void>
+        requires kissra::char_iterator<TSelf>
+    constexpr auto split(this TSelf&& self, TDelim delim) {
+        return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+            return impl::make_split_iter<TMixins...>(self, impl::as_split_delimiter(delim));
+        });
+    }
+};
+
+template <typename TRng, typename TDelim, typename DeferInstantiation = void>
+    requires kissra::char_range<TRng> && (std::is_lvalue_reference_v<TRng> || std::ranges::borrowed_range<TRng>)
+constexpr auto split(TRng&& rng, TDelim delim) {
+    return with_custom_mixins<DeferInstantiation>([&]<template <typename> typename... TMixins> {
+        return impl::make_split_iter<TMixins...>(
+            std::string_view{ std::ranges::data(rng), std::ranges::size(rng) }, impl::as_split_delimiter(delim));
+    });
+}
+
+template <kissra::char_iterator T, typename TDelim>
+constexpr auto split(T&& kissra_iter, TDelim delim) {
+    return kissra_iter.split(delim);
+}
+
+
+namespace compo {
+template <typename TBaseCompose, split_delimiter TDelim, template <typename> typename... TMixinsCompose>
+struct split_compose : public builtin_mixins_compose<TBaseCompose>, public TMixinsCompose<TBaseCompose>... {
+    [[no_unique_address]] TBaseCompose base_comp;
+    TDelim delim;
+
+    template <template <typename> typename... TMixins, typename TSelf, kissra::char_iterator UBaseIter>
+    constexpr auto make_iter(this TSelf&& self, UBaseIter&& base_iter) {
+        return impl::make_split_iter<TMixins...>(base_iter, self.delim);
+    }
+};
+
+template <typename Tag>
+struct split_compose_mixin {
+    template <typename TSelf, typename TDelim, typename DeferInstantiation = void>
+    constexpr auto split(this TSelf&& self, TDelim delim) {
+        using delim_t = decltype(impl::as_split_delimiter(delim));
+        return with_custom_mixins_compose<DeferInstantiation>([&]<template <typename> typename... TMixinsCompose> {
+            return split_compose<std::remove_cvref_t<TSelf>, delim_t, TMixinsCompose...>{
+                .base_comp = std::forward<TSelf>(self),
+                .delim = impl::as_split_delimiter(delim),
+            };
+        });
+    }
+};
+
+template <typename TDelim, typename DeferInstantiation = void>
+constexpr auto split(TDelim delim) {
+    return compose<DeferInstantiation>().split(delim);
+}
+} // namespace compo
+} // namespace kissra
\ No newline at end of file
@@ -82,6 +82,10 @@ public:
         return this->base_iter.size();
     }
 
+    constexpr auto& transform_fn() {
+        return this->fn.inst;
+    }
+
 private:
     [[no_unique_address]] functor_ebo<TFn, TBaseIter> fn;
 };
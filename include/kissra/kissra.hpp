@@ -1,37 +1,63 @@
 #pragma once
 #include "kissra/concepts.hpp"
+#include "kissra/fn/agg.hpp"
 #include "kissra/fn/cmp.hpp"
 #include "kissra/fn/convert.hpp"
 #include "kissra/fn/member.hpp"
 #include "kissra/fn/misc.hpp"
 #include "kissra/fn/num.hpp"
+#include "kissra/impl/algo/all_of_mixin.hpp"
 #include "kissra/impl/algo/apply_mixin.hpp"
 #include "kissra/impl/algo/back_mixin.hpp"
 #include "kissra/impl/algo/collect_mixin.hpp"
+#include "kissra/impl/algo/contiguous.hpp"
+#include "kissra/impl/algo/count_mixin.hpp"
 #include "kissra/impl/algo/empty_mixin.hpp"
 #include "kissra/impl/algo/find_mixin.hpp"
 #include "kissra/impl/algo/front_mixin.hpp"
+#include "kissra/impl/algo/group_by_mixin.hpp"
+#include "kissra/impl/algo/histogram_mixin.hpp"
+#include "kissra/impl/algo/minmax_mixin.hpp"
+#include "kissra/impl/algo/par_mixin.hpp"
+#include "kissra/impl/algo/partition_mixin.hpp"
+#include "kissra/impl/algo/quantile_mixin.hpp"
+#include "kissra/impl/algo/sort_mixin.hpp"
+#include "kissra/impl/algo/split_at_mixin.hpp"
 #include "kissra/impl/algo/ssize_mixin.hpp"
+#include "kissra/impl/algo/sum_mixin.hpp"
+#include "kissra/impl/algo/top_k_mixin.hpp"
 #include "kissra/impl/compose.hpp"
 #include "kissra/impl/custom_mixins.hpp"
 #include "kissra/impl/export.hpp"
 #include "kissra/impl/iter/all_iter.hpp"
+#include "kissra/impl/iter/cache_latest_iter.hpp"
 #include "kissra/impl/iter/chunk_iter.hpp"
+#include "kissra/impl/iter/distinct_iter.hpp"
 #include "kissra/impl/iter/drop_iter.hpp"
 #include "kissra/impl/iter/drop_last_iter.hpp"
 #include "kissra/impl/iter/drop_last_while_iter.hpp"
 #include "kissra/impl/iter/drop_while_iter.hpp"
 #include "kissra/impl/iter/filter_iter.hpp"
+#include "kissra/impl/iter/hash_join_iter.hpp"
 #include "kissra/impl/iter/iter_base.hpp"
 #include "kissra/impl/iter/keys_iter.hpp"
+#include "kissra/impl/iter/lines_iter.hpp"
 #include "kissra/impl/iter/members_iter.hpp"
+#include "kissra/impl/iter/read_iter.hpp"
 #include "kissra/impl/iter/reverse_iter.hpp"
+#include "kissra/impl/iter/split_iter.hpp"
 #include "kissra/impl/iter/take_iter.hpp"
 #include "kissra/impl/iter/transform_iter.hpp"
 #include "kissra/impl/iter/values_iter.hpp"
 #include "kissra/impl/iter/zip_iter.hpp"
+#include "kissra/misc/fd_reader.hpp"
+#include "kissra/misc/flat_hash_map.hpp"
 #include "kissra/misc/functional.hpp"
+#include "kissra/misc/mapped_file.hpp"
 #include "kissra/misc/optional.hpp"
+#include "kissra/misc/search.hpp"
+#include "kissra/misc/static_vector.hpp"
+#include "kissra/misc/thread_pool.hpp"
 #include "kissra/misc/utility.hpp"
 #include "kissra/type_traits.hpp"
 
@@ -54,7 +80,11 @@ struct builtin_mixins_compose : filter_compose_mixin<Tag>,
                                 drop_compose_mixin<Tag>,
                                 drop_last_compose_mixin<Tag>,
                                 drop_while_compose_mixin<Tag>,
-                                drop_last_while_compose_mixin<Tag> {};
+                                drop_last_while_compose_mixin<Tag>,
+                                cache_latest_compose_mixin<Tag>,
+                                split_compose_mixin<Tag>,
+                                distinct_compose_mixin<Tag>,
+                                hash_join_compose_mixin<Tag> {};
 } // namespace compo
 
 template <typename Tag>
@@ -71,13 +101,29 @@ struct builtin_mixins : filter_mixin<Tag>,
                         drop_last_mixin<Tag>,
                         drop_while_mixin<Tag>,
                         drop_last_while_mixin<Tag>,
+                        cache_latest_mixin<Tag>,
+                        split_mixin<Tag>,
+                        distinct_mixin<Tag>,
+                        hash_join_mixin<Tag>,
                         collect_mixin<Tag>,
+                        partition_mixin<Tag>,
                         front_mixin<Tag>,
                         apply_mixin<Tag>,
                         back_mixin<Tag>,
                         find_mixin<Tag>,
                         empty_mixin<Tag>,
-                        ssize_mixin<Tag> {};
+                        ssize_mixin<Tag>,
+                        top_k_mixin<Tag>,
+                        minmax_mixin<Tag>,
+                        sum_mixin<Tag>,
+                        count_mixin<Tag>,
+                        all_of_mixin<Tag>,
+                        sort_mixin<Tag>,
+                        group_by_mixin<Tag>,
+                        histogram_mixin<Tag>,
+                        quantile_mixin<Tag>,
+                        split_at_mixin<Tag>,
+                        par_mixin<Tag> {};
 
 /**
  * To hook into the library's mixins system and add support for your custom mixins, you need to specialize the
@@ -0,0 +1,108 @@
+#pragma once
+#include "kissra/impl/export.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#endif
+#endif
+
+#if __has_include(<unistd.h>)
+#define KISSRA_HAS_POSIX_READ 1
+#else
+#define KISSRA_HAS_POSIX_READ 0
+#endif
+
+#if KISSRA_HAS_POSIX_READ
+KISSRA_EXPORT()
+namespace kissra {
+/**
+ * Double-buffered reader of a (non-owned) file descriptor: pipes, stdin, sockets - anything which can't be mapped.
+ * Unconsumed bytes of the active buffer are carried over into the other buffer on `refill`, so that a record which
+ * straddles the boundary of two reads stays contiguous. Views into the active buffer stay valid until the second
+ * `refill` from now (i.e. views of the current block survive while the next block is being consumed).
+ * A buffer grows (doubles) only when a single unconsumed record doesn't fit into it.
+ */
+class fd_reader {
+public:
+    fd_reader(int fd, std::size_t block_size)
+        : fd(fd)
+        , buffers{ buffer{ block_size }, buffer{ block_size } } {}
+
+    /* Bytes read but not consumed yet. */
+    std::string_view buffered() const noexcept {
+        return { this->buffers[this->active].data.get() + this->pos, this->end - this->pos };
+    }
+
+    void consume(std::size_t n) noexcept {
+        this->pos += n;
+    }
+
+    /**
+     * Carry unconsumed bytes over into the other buffer and read until at least `min_size` bytes are buffered (or the
+     * end of the stream is reached). Returns `false` if nothing new could be read.
+     */
+    bool refill(std::size_t min_size = 1) {
+        if (this->at_eof) {
+            return false;
+        }
+
+        const auto tail = this->end - this->pos;
+        auto& next = this->buffers[this->active ^ 1];
+        if (next.capacity < std::max(tail * 2, min_size)) {
+            next = buffer{ std::max({ next.capacity * 2, tail * 2, min_size }) };
+        }
+        std::memcpy(next.data.get(), this->buffers[this->active].data.get() + this->pos, tail);
+
+        std::size_t size = tail;
+        const auto target = std::min(std::max(min_size, tail + 1), next.capacity);
+        while (size < target) {
+            const auto n = ::read(this->fd, next.data.get() + size, next.capacity - size);
+            if (n == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "kissra::fd_reader: read");
+            }
+            if (n == 0) {
+                this->at_eof = true;
+                break;
+            }
+            size += std::size_t(n);
+        }
+
+        this->active ^= 1;
+        this->pos = 0;
+        this->end = size;
+        return size != tail;
+    }
+
+private:
+    struct buffer {
+        explicit buffer(std::size_t capacity)
+            : data(std::make_unique_for_overwrite<char[]>(capacity))
+            , capacity(capacity) {}
+
+        std::unique_ptr<char[]> data;
+        std::size_t capacity;
+    };
+
+private:
+    int fd;
+    buffer buffers[2];
+    unsigned active{};
+    std::size_t pos{};
+    std::size_t end{};
+    bool at_eof{};
+};
+} // namespace kissra
+#endif
\ No newline at end of file
@@ -0,0 +1,330 @@
+#pragma once
+#include "kissra/impl/export.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/**
+ * Open-addressing (linear probing) index over entries stored elsewhere, densely and in the insertion order. A slot is
+ * 8 bytes: a tag (32 bits of the hash, to skip most of the key comparisons) and the position of its entry. Full hashes
+ * of the entries are kept aside so that growing never rehashes a key. There is no erasure.
+ */
+class flat_hash_index {
+public:
+    /* Spread `std::hash` output (the identity for integers in most implementations) over all the 64 bits. */
+    static constexpr std::uint64_t mix(std::uint64_t hash) {
+        hash ^= hash >> 32;
+        hash *= 0x9e3779b97f4a7c15ull;
+        return hash ^ (hash >> 29);
+    }
+
+    constexpr std::size_t size() const {
+        return this->hashes.size();
+    }
+
+    constexpr void reserve(std::size_t count) {
+        this->hashes.reserve(count);
+        if (count > this->max_load()) {
+            this->rehash(flat_hash_index::capacity_for(count));
+        }
+    }
+
+    /* Position of the entry with `hash` which `matches(position)` holds for, `size()` if there is none. */
+    template <typename TMatches>
+    constexpr std::size_t find(std::uint64_t hash, TMatches&& matches) const {
+        if (this->slots.empty()) {
+            return this->size();
+        }
+        const auto tag = static_cast<std::uint32_t>(hash);
+        for (std::size_t i = this->bucket_of(hash);; i = (i + 1) & this->mask()) {
+            const slot s = this->slots[i];
+            if (s.position == 0) {
+                return this->size();
+            }
+            if (s.tag == tag && matches(std::size_t(s.position - 1))) {
+                return s.position - 1;
+            }
+        }
+    }
+
+    /**
+     * (Position, inserted): the position of the matching entry, or of a new one which `append()` puts right after the
+     * others. The new entry is only indexed once `append()` returns, so a throwing `append()` leaves the index intact.
+     */
+    template <typename TMatches, typename TAppend>
+    constexpr std::pair<std::size_t, bool> find_or_insert(std::uint64_t hash, TMatches&& matches, TAppend&& append) {
+        if (this->size() + 1 > this->max_load()) {
+            this->rehash(flat_hash_index::capacity_for(this->size() + 1));
+        }
+        if (this->hashes.size() == this->hashes.capacity()) {
+            /* Publishing the new entry mustn't throw once it is appended. */
+            this->hashes.reserve(std::max<std::size_t>(16, this->hashes.capacity() * 2));
+        }
+        const auto tag = static_cast<std::uint32_t>(hash);
+        for (std::size_t i = this->bucket_of(hash);; i = (i + 1) & this->mask()) {
+            slot& s = this->slots[i];
+            if (s.position == 0) {
+                append();
+                s = slot{ tag, static_cast<std::uint32_t>(this->size() + 1) };
+                this->hashes.push_back(hash);
+                return { this->size() - 1, true };
+            }
+            if (s.tag == tag && matches(std::size_t(s.position - 1))) {
+                return { s.position - 1, false };
+            }
+        }
+    }
+
+private:
+    struct slot {
+        std::uint32_t tag;
+        /* Entry position + 1, 0 marks an empty slot. */
+        std::uint32_t position;
+    };
+
+    /* Load factor of at most 3/4 keeps linear probing sequences short. */
+    static constexpr std::size_t capacity_for(std::size_t count) {
+        return std::bit_ceil(std::max<std::size_t>(16, count + count / 3 + 1));
+    }
+
+    constexpr std::size_t max_load() const {
+        return this->slots.size() / 4 * 3;
+    }
+
+    constexpr std::size_t mask() const {
+        return this->slots.size() - 1;
+    }
+
+    /* The high bits of the hash pick the bucket, the low ones make the tag. */
+    constexpr std::size_t bucket_of(std::uint64_t hash) const {
+        return static_cast<std::size_t>(hash >> this->shift);
+    }
+
+    constexpr void rehash(std::size_t capacity) {
+        this->slots.assign(capacity, slot{ 0, 0 });
+        this->shift = 64 - std::countr_zero(capacity);
+        for (std::size_t position = 0; position != this->hashes.size(); ++position) {
+            const auto hash = this->hashes[position];
+            std::size_t i = this->bucket_of(hash);
+            while (this->slots[i].position != 0) {
+                i = (i + 1) & this->mask();
+            }
+            this->slots[i] = slot{ static_cast<std::uint32_t>(hash), static_cast<std::uint32_t>(position + 1) };
+        }
+    }
+
+    std::vector<slot> slots;
+    std::vector<std::uint64_t> hashes;
+    int shift = 64;
+};
+} // namespace impl
+
+/**
+ * Insertion-ordered hash map without per-entry allocations: `(key, value)` pairs are stored contiguously (iteration is
+ * a plain vector scan), lookups go through `impl::flat_hash_index`. Holds up to 2^32 - 1 entries, there is no erasure.
+ * `*_hashed` members take the (`hash_of`) hash precomputed by the caller.
+ */
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TEq = std::equal_to<TKey>>
+class flat_hash_map {
+public:
+    using key_type = TKey;
+    using mapped_type = TValue;
+    using value_type = std::pair<TKey, TValue>;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    constexpr flat_hash_map() = default;
+
+    constexpr explicit flat_hash_map(std::size_t capacity) {
+        this->reserve(capacity);
+    }
+
+    constexpr std::uint64_t hash_of(const TKey& key) const {
+        return impl::flat_hash_index::mix(static_cast<std::uint64_t>(this->hash(key)));
+    }
+
+    constexpr void reserve(std::size_t capacity) {
+        this->entries.reserve(capacity);
+        this->index.reserve(capacity);
+    }
+
+    /* (Entry, inserted): `TValue(args...)` is only constructed if `key` is not in the map yet. */
+    template <typename TKeyArg, typename... TArgs>
+    constexpr std::pair<value_type&, bool> try_emplace_hashed(std::uint64_t hash, TKeyArg&& key, TArgs&&... args) {
+        const auto [position, inserted] = this->index.find_or_insert(
+            hash,
+            [&](std::size_t candidate) { return this->eq(this->entries[candidate].first, key); },
+            [&] {
+                this->entries.emplace_back(std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<TKeyArg>(key)),
+                    std::forward_as_tuple(std::forward<TArgs>(args)...));
+            });
+        return { this->entries[position], inserted };
+    }
+
+    template <typename... TArgs>
+    constexpr std::pair<value_type&, bool> try_emplace(const TKey& key, TArgs&&... args) {
+        return this->try_emplace_hashed(this->hash_of(key), key, std::forward<TArgs>(args)...);
+    }
+
+    template <typename... TArgs>
+    constexpr std::pair<value_type&, bool> try_emplace(TKey&& key, TArgs&&... args) {
+        const auto hash = this->hash_of(key);
+        return this->try_emplace_hashed(hash, std::move(key), std::forward<TArgs>(args)...);
+    }
+
+    constexpr TValue& operator[](const TKey& key) {
+        return this->try_emplace(key).first.second;
+    }
+
+    constexpr const value_type* find_hashed(std::uint64_t hash, const TKey& key) const {
+        const auto position = this->index.find(hash, [&](std::size_t candidate) {
+            return this->eq(this->entries[candidate].first, key);
+        });
+        return position != this->entries.size() ? &this->entries[position] : nullptr;
+    }
+
+    constexpr value_type* find(const TKey& key) {
+        return const_cast<value_type*>(std::as_const(*this).find_hashed(this->hash_of(key), key));
+    }
+
+    constexpr const value_type* find(const TKey& key) const {
+        return this->find_hashed(this->hash_of(key), key);
+    }
+
+    constexpr bool contains(const TKey& key) const {
+        return this->find(key) != nullptr;
+    }
+
+    /* Same keys (and lookup structure) with every value replaced by `fn(std::move(value))`. */
+    template <typename TFn>
+    constexpr auto transform_values(TFn fn) && {
+        using value_t = std::remove_cvref_t<std::invoke_result_t<TFn&, TValue&&>>;
+        flat_hash_map<TKey, value_t, THash, TEq> result;
+        result.entries.reserve(this->entries.size());
+        for (auto& [key, value] : this->entries) {
+            result.entries.emplace_back(std::move(key), std::invoke(fn, std::move(value)));
+        }
+        result.index = std::move(this->index);
+        this->entries.clear();
+        return result;
+    }
+
+    constexpr std::size_t size() const {
+        return this->entries.size();
+    }
+
+    constexpr bool empty() const {
+        return this->entries.empty();
+    }
+
+    constexpr iterator begin() {
+        return this->entries.begin();
+    }
+
+    constexpr const_iterator begin() const {
+        return this->entries.begin();
+    }
+
+    constexpr iterator end() {
+        return this->entries.end();
+    }
+
+    constexpr const_iterator end() const {
+        return this->entries.end();
+    }
+
+private:
+    template <typename, typename, typename, typename>
+    friend class flat_hash_map;
+
+    std::vector<value_type> entries;
+    impl::flat_hash_index index;
+    [[no_unique_address]] THash hash;
+    [[no_unique_address]] TEq eq;
+};
+
+/* Insertion-ordered hash set, same layout as `flat_hash_map` (keys stored contiguously). */
+template <typename TKey, typename THash = std::hash<TKey>, typename TEq = std::equal_to<TKey>>
+class flat_hash_set {
+public:
+    using key_type = TKey;
+    using value_type = TKey;
+    using const_iterator = typename std::vector<TKey>::const_iterator;
+    using iterator = const_iterator;
+
+    constexpr flat_hash_set() = default;
+
+    constexpr explicit flat_hash_set(std::size_t capacity) {
+        this->reserve(capacity);
+    }
+
+    constexpr std::uint64_t hash_of(const TKey& key) const {
+        return impl::flat_hash_index::mix(static_cast<std::uint64_t>(this->hash(key)));
+    }
+
+    constexpr void reserve(std::size_t capacity) {
+        this->keys.reserve(capacity);
+        this->index.reserve(capacity);
+    }
+
+    /* Whether `key` has been inserted (i.e. it was not in the set yet). */
+    template <typename TKeyArg>
+    constexpr bool insert_hashed(std::uint64_t hash, TKeyArg&& key) {
+        const auto [position, inserted] = this->index.find_or_insert(
+            hash,
+            [&](std::size_t candidate) { return this->eq(this->keys[candidate], key); },
+            [&] { this->keys.emplace_back(std::forward<TKeyArg>(key)); });
+        return inserted;
+    }
+
+    constexpr bool insert(const TKey& key) {
+        return this->insert_hashed(this->hash_of(key), key);
+    }
+
+    constexpr bool insert(TKey&& key) {
+        const auto hash = this->hash_of(key);
+        return this->insert_hashed(hash, std::move(key));
+    }
+
+    constexpr bool contains(const TKey& key) const {
+        const auto position = this->index.find(this->hash_of(key), [&](std::size_t candidate) {
+            return this->eq(this->keys[candidate], key);
+        });
+        return position != this->keys.size();
+    }
+
+    constexpr std::size_t size() const {
+        return this->keys.size();
+    }
+
+    constexpr bool empty() const {
+        return this->keys.empty();
+    }
+
+    constexpr const_iterator begin() const {
+        return this->keys.begin();
+    }
+
+    constexpr const_iterator end() const {
+        return this->keys.end();
+    }
+
+private:
+    std::vector<TKey> keys;
+    impl::flat_hash_index index;
+    [[no_unique_address]] THash hash;
+    [[no_unique_address]] TEq eq;
+};
+} // namespace kissra
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+#include "kissra/impl/export.hpp"
+
+#ifndef KISSRA_MODULE
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#endif
+
+#if __has_include(<sys/mman.h>)
+#define KISSRA_HAS_MMAP 1
+#else
+#define KISSRA_HAS_MMAP 0
+#endif
+
+#if KISSRA_HAS_MMAP
+KISSRA_EXPORT()
+namespace kissra {
+/**
+ * Read-only memory mapping of a whole file (RAII, move-only).
+ * The mapping is advised as sequential (`MADV_SEQUENTIAL`) so that the kernel reads ahead aggressively and drops
+ * already consumed pages early. Empty files are not mapped at all (`mmap` doesn't support zero-length mappings).
+ */
+class mapped_file {
+public:
+    explicit mapped_file(const std::filesystem::path& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            throw std::system_error(errno, std::generic_category(), "kissra::mapped_file: open");
+        }
+
+        struct ::stat st {};
+        if (::fstat(fd, &st) == -1) {
+            const int err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(), "kissra::mapped_file: fstat");
+        }
+
+        const auto size = std::size_t(st.st_size);
+        if (size != 0) {
+            void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                const int err = errno;
+                ::close(fd);
+                throw std::system_error(err, std::generic_category(), "kissra::mapped_file: mmap");
+            }
+            /* Just a hint - failure is not an error. */
+            ::madvise(addr, size, MADV_SEQUENTIAL);
+
+            this->addr = static_cast<const char*>(addr);
+            this->length = size;
+        }
+
+        /* The mapping keeps the file referenced on its own. */
+        ::close(fd);
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&& other) noexcept
+        : addr(std::exchange(other.addr, nullptr))
+        , length(std::exchange(other.length, 0)) {}
+
+    mapped_file& operator=(mapped_file&& other) noexcept {
+        if (this != &other) {
+            this->unmap();
+            this->addr = std::exchange(other.addr, nullptr);
+            this->length = std::exchange(other.length, 0);
+        }
+        return *this;
+    }
+
+    ~mapped_file() {
+        this->unmap();
+    }
+
+    std::span<const char> bytes() const noexcept {
+        return { this->addr, this->length };
+    }
+
+    std::string_view view() const noexcept {
+        return { this->addr, this->length };
+    }
+
+    std::size_t size() const noexcept {
+        return this->length;
+    }
+
+private:
+    void unmap() noexcept {
+        if (this->addr) {
+            ::munmap(const_cast<char*>(this->addr), this->length);
+        }
+    }
+
+private:
+    const char* addr{};
+    std::size_t length{};
+};
+} // namespace kissra
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+#include "kissra/impl/export.hpp"
+
+#ifndef KISSRA_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra::impl {
+/**
+ * Forward byte search. `std::char_traits<char>::find` boils down to `memchr` (vectorized by every sane libc) at runtime
+ * and is still usable in constant evaluation.
+ */
+constexpr const char* find_byte(const char* first, const char* last, char c) noexcept {
+    return std::char_traits<char>::find(first, std::size_t(last - first), c);
+}
+
+/**
+ * Backward byte search. There is no portable `memrchr`, so test 8 bytes at a time (SWAR "has zero byte" trick on
+ * `word ^ pattern`) and only fall back to the byte-wise loop inside the word which contains a match.
+ */
+constexpr const char* find_last_byte(const char* first, const char* last, char c) noexcept {
+    if !consteval {
+        constexpr std::uint64_t ones = 0x0101'0101'0101'0101ull;
+        constexpr std::uint64_t highs = 0x8080'8080'8080'8080ull;
+        const std::uint64_t pattern = ones * static_cast<unsigned char>(c);
+
+        while (last - first >= 8) {
+            std::uint64_t word;
+            std::memcpy(&word, last - 8, sizeof(word));
+
+            const std::uint64_t x = word ^ pattern;
+            if ((x - ones) & ~x & highs) {
+                break;
+            }
+            last -= 8;
+        }
+    }
+
+    while (last != first) {
+        if (*--last == c) {
+            return last;
+        }
+    }
+    return nullptr;
+}
+} // namespace kissra::impl
\ No newline at end of file
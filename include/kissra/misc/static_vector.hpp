@@ -0,0 +1,171 @@
+#pragma once
+#include "kissra/impl/export.hpp"
+
+#ifndef KISSRA_MODULE
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+/**
+ * Vector with the storage for up to `Capacity` items inline (no heap allocations), a subset of `std::inplace_vector`.
+ * Items are constructed on demand, so `T` doesn't have to be default constructible.
+ */
+template <typename T, std::size_t Capacity>
+class static_vector {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr static_vector() noexcept {}
+
+    constexpr static_vector(const static_vector& other) {
+        for (const T& item : other) {
+            this->unchecked_emplace_back(item);
+        }
+    }
+
+    constexpr static_vector(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        for (T& item : other) {
+            this->unchecked_emplace_back(std::move(item));
+        }
+    }
+
+    constexpr static_vector& operator=(const static_vector& other) {
+        if (this != &other) {
+            this->clear();
+            for (const T& item : other) {
+                this->unchecked_emplace_back(item);
+            }
+        }
+        return *this;
+    }
+
+    constexpr static_vector& operator=(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            this->clear();
+            for (T& item : other) {
+                this->unchecked_emplace_back(std::move(item));
+            }
+        }
+        return *this;
+    }
+
+    constexpr ~static_vector() {
+        this->clear();
+    }
+
+    static constexpr size_type capacity() noexcept {
+        return Capacity;
+    }
+
+    static constexpr size_type max_size() noexcept {
+        return Capacity;
+    }
+
+    constexpr size_type size() const noexcept {
+        return this->count;
+    }
+
+    constexpr bool empty() const noexcept {
+        return this->count == 0;
+    }
+
+    constexpr bool full() const noexcept {
+        return this->count == Capacity;
+    }
+
+    constexpr T* data() noexcept {
+        return this->items;
+    }
+
+    constexpr const T* data() const noexcept {
+        return this->items;
+    }
+
+    constexpr iterator begin() noexcept {
+        return this->items;
+    }
+
+    constexpr const_iterator begin() const noexcept {
+        return this->items;
+    }
+
+    constexpr iterator end() noexcept {
+        return this->items + this->count;
+    }
+
+    constexpr const_iterator end() const noexcept {
+        return this->items + this->count;
+    }
+
+    constexpr T& operator[](size_type idx) noexcept {
+        return this->items[idx];
+    }
+
+    constexpr const T& operator[](size_type idx) const noexcept {
+        return this->items[idx];
+    }
+
+    /* Precondition: `!full()`. */
+    template <typename... TArgs>
+    constexpr T& unchecked_emplace_back(TArgs&&... args) {
+        T* item = std::construct_at(this->items + this->count, std::forward<TArgs>(args)...);
+        ++this->count;
+        return *item;
+    }
+
+    /* `nullptr` if there is no room left (nothing is constructed then). */
+    template <typename... TArgs>
+    constexpr T* try_emplace_back(TArgs&&... args) {
+        if (this->full()) {
+            return nullptr;
+        }
+        return std::addressof(this->unchecked_emplace_back(std::forward<TArgs>(args)...));
+    }
+
+    constexpr T* try_push_back(const T& item) {
+        return this->try_emplace_back(item);
+    }
+
+    constexpr T* try_push_back(T&& item) {
+        return this->try_emplace_back(std::move(item));
+    }
+
+    constexpr void pop_back() {
+        std::destroy_at(this->items + --this->count);
+    }
+
+    constexpr void clear() noexcept {
+        while (this->count != 0) {
+            this->pop_back();
+        }
+    }
+
+    friend constexpr bool operator==(const static_vector& l, const static_vector& r) {
+        if (l.size() != r.size()) {
+            return false;
+        }
+        for (size_type i = 0; i != l.size(); ++i) {
+            if (!(l[i] == r[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    /* Zero-length arrays are ill-formed: a zero capacity vector keeps the storage for one item, it is never used. */
+    union {
+        T items[Capacity != 0 ? Capacity : 1];
+    };
+    size_type count = 0;
+};
+} // namespace kissra
\ No newline at end of file
@@ -0,0 +1,156 @@
+#pragma once
+#include "kissra/impl/export.hpp"
+
+#ifndef KISSRA_MODULE
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+KISSRA_EXPORT()
+namespace kissra {
+namespace impl {
+/* Set within the pool threads (and within the caller while it helps out): nested `run`s don't wait for the pool. */
+inline thread_local bool within_thread_pool = false;
+} // namespace impl
+
+/**
+ * Fixed set of worker threads executing one batch of tasks at a time (see `run`). Tasks are handed out dynamically
+ * (an atomic counter), so faster threads simply take more of them. The calling thread takes tasks as well.
+ */
+class thread_pool {
+public:
+    /* `threads` counts the calling thread in, i.e. `threads - 1` workers are spawned (none for both 0 and 1). */
+    explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency()) {
+        threads = std::max(threads, 1uz);
+        this->workers.reserve(threads - 1);
+        for (std::size_t i = 1; i < threads; ++i) {
+            this->workers.emplace_back([this] { this->work(); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool() {
+        {
+            std::scoped_lock lock{ this->mutex };
+            this->stopping = true;
+        }
+        this->wake.notify_all();
+    }
+
+    /* Pool shared by every `par()` pipeline, spawned on first use. */
+    static thread_pool& shared() {
+        static thread_pool pool;
+        return pool;
+    }
+
+    std::size_t concurrency() const {
+        return this->workers.size() + 1;
+    }
+
+    /**
+     * Invoke `fn(task)` for every task of `[0, tasks)` and wait for all of them. The first exception thrown by a task is
+     * rethrown (tasks which haven't started by then are skipped). Nested calls (from within a task) run inline.
+     */
+    template <typename TFn>
+    void run(std::size_t tasks, TFn&& fn) {
+        if (tasks == 0) {
+            return;
+        }
+        if (tasks == 1 || this->workers.empty() || impl::within_thread_pool) {
+            for (std::size_t task = 0; task != tasks; ++task) {
+                fn(task);
+            }
+            return;
+        }
+
+        std::scoped_lock exclusive{ this->run_mutex };
+        batch current{ tasks, std::addressof(fn), [](void* fn, std::size_t task) { (*static_cast<TFn*>(fn))(task); } };
+        {
+            std::scoped_lock lock{ this->mutex };
+            this->current = &current;
+            ++this->generation;
+        }
+        this->wake.notify_all();
+
+        current.execute();
+
+        {
+            /* Late workers may still be busy with the tasks they took; those which haven't woken up yet see no batch. */
+            std::unique_lock lock{ this->mutex };
+            this->idle.wait(lock, [&] { return this->busy == 0; });
+            this->current = nullptr;
+        }
+        if (current.error) {
+            std::rethrow_exception(current.error);
+        }
+    }
+
+private:
+    struct batch {
+        std::size_t tasks;
+        void* fn;
+        void (*invoke)(void*, std::size_t);
+        std::atomic<std::size_t> next = 0;
+        std::atomic_flag failed;
+        std::exception_ptr error;
+
+        void execute() {
+            const bool nested = std::exchange(impl::within_thread_pool, true);
+            for (std::size_t task; (task = this->next.fetch_add(1, std::memory_order_relaxed)) < this->tasks;) {
+                try {
+                    this->invoke(this->fn, task);
+                } catch (...) {
+                    if (!this->failed.test_and_set()) {
+                        this->error = std::current_exception();
+                        this->next.store(this->tasks, std::memory_order_relaxed);
+                    }
+                }
+            }
+            impl::within_thread_pool = nested;
+        }
+    };
+
+    void work() {
+        std::unique_lock lock{ this->mutex };
+        for (std::size_t seen = 0;;) {
+            this->wake.wait(lock, [&] { return this->stopping || (this->current && this->generation != seen); });
+            if (this->stopping) {
+                return;
+            }
+            seen = this->generation;
+            batch* current = this->current;
+            ++this->busy;
+            lock.unlock();
+
+            current->execute();
+
+            lock.lock();
+            if (--this->busy == 0) {
+                this->idle.notify_all();
+            }
+        }
+    }
+
+    std::mutex run_mutex;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    batch* current = nullptr;
+    std::size_t generation = 0;
+    std::size_t busy = 0;
+    bool stopping = false;
+    /* Last member: workers are joined before anything they use is destroyed. */
+    std::vector<std::jthread> workers;
+};
+} // namespace kissra
@@ -4,6 +4,7 @@
 #define KISSRA_FWD(x) std::forward<decltype(x)>(x)
 
 #ifndef KISSRA_MODULE
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 #endif
@@ -28,4 +29,9 @@ constexpr decltype(auto) forward_member(T&& member) {
 
 template <typename>
 constexpr bool always_false = false;
+
+namespace impl {
+/* Not `std::hardware_destructive_interference_size` - its value is not ABI-stable (GCC warns on its use in headers). */
+inline constexpr std::size_t cache_line_size = 64;
+} // namespace impl
 } // namespace kissra
\ No newline at end of file
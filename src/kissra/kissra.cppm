@@ -1,3 +1,15 @@
+module;
+/* Platform (non-`std`) headers can't be imported, hence have to live in the global module fragment. */
+#if __has_include(<unistd.h>)
+#include <cerrno>
+#include <unistd.h>
+#endif
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 export module kissra;
 import beman;
 import std;
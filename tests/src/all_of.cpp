@@ -0,0 +1,83 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <algorithm>
+#include <array>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+TEST_CASE("all_of/any_of/none_of should check pred over the items") {
+    std::array arr = { "a"s, "bb"s, "cc"s };
+    const auto nonempty = [](const std::string& s) { return !s.empty(); };
+    const auto long_one = [](const std::string& s) { return s.size() > 1; };
+
+    CHECK(kissra::all(arr).all_of(nonempty));
+    CHECK_FALSE(kissra::all(arr).all_of(long_one));
+    CHECK(kissra::all(arr).any_of(long_one));
+    CHECK_FALSE(kissra::all(arr).none_of(long_one));
+    CHECK(kissra::all(arr).drop(3).all_of(long_one));
+    CHECK_FALSE(kissra::all(arr).drop(3).any_of(nonempty));
+    CHECK(kissra::all(arr).drop(3).none_of(nonempty));
+}
+
+TEST_CASE("any_of should short-circuit on non-contiguous iterators") {
+    std::list lst = { 1, 2, 3, 4, 5 };
+    auto iter = kissra::all(lst);
+
+    CHECK(iter.any_of(kissra::fn::eq(2)));
+    CHECK_EQ(*iter.next(), 3);
+}
+
+TEST_CASE("all_of/any_of/none_of(fn::*) over many contiguous items should match std::ranges") {
+    std::vector<int> vec(100'003);
+    std::iota(vec.begin(), vec.end(), -50'000);
+
+    CHECK(kissra::all(vec).all_of(kissra::fn::ge(-50'000)));
+    CHECK_FALSE(kissra::all(vec).all_of(kissra::fn::lt_c<50'002>));
+    CHECK(kissra::all(vec).any_of(kissra::fn::eq(50'002)));
+    CHECK_FALSE(kissra::all(vec).any_of(kissra::fn::gt_c<50'002>));
+    CHECK(kissra::all(vec).none_of(kissra::fn::gt_c<50'002>));
+    CHECK_FALSE(kissra::all(vec).none_of(kissra::fn::even));
+    CHECK_FALSE(kissra::all(vec).drop(7).any_of(kissra::fn::lt_c<-49'993>));
+    CHECK(kissra::all(vec).drop(7).any_of(kissra::fn::lt_c<-49'992>));
+}
+
+TEST_CASE("filter().all_of(fn::*) should only check items passing the filter") {
+    std::vector<int> vec(1'000);
+    std::iota(vec.begin(), vec.end(), 0);
+    vec[501] = 3;
+
+    CHECK(kissra::all(vec).filter(kissra::fn::divisible_by_c<4>).all_of(kissra::fn::even));
+    CHECK_FALSE(kissra::all(vec).filter(kissra::fn::odd).all_of(kissra::fn::gt_c<5>));
+    CHECK(kissra::all(vec).drop(500).any_of(kissra::fn::lt_c<5>));
+    CHECK(kissra::all(vec).transform([](int x) { return x * 2; }).none_of(kissra::fn::odd));
+}
+
+TEST_CASE("any_of over a contiguous iterator should leave it right after the deciding item") {
+    std::vector<int> vec(1'000);
+    std::iota(vec.begin(), vec.end(), 0);
+    auto iter = kissra::all(vec);
+
+    CHECK(iter.any_of(kissra::fn::eq(100)));
+    CHECK_EQ(*iter.next(), 101);
+}
+
+TEST_CASE("any_of over transformed contiguous items should call the transform only up to the deciding item") {
+    std::vector<int> vec(1'000);
+    std::iota(vec.begin(), vec.end(), 0);
+    int calls = 0;
+
+    CHECK(kissra::all(vec)
+              .transform([&](int x) {
+                  ++calls;
+                  return x;
+              })
+              .any_of(kissra::fn::eq(10)));
+    CHECK_EQ(calls, 11);
+}
+} // namespace kissra::test
\ No newline at end of file
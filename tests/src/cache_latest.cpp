@@ -0,0 +1,157 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include "kissra/noisy.hpp"
+#include <algorithm>
+#include <forward_list>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+TEST_CASE("transform().cache_latest() should evaluate the projection once per item on front() + next()") {
+    std::array arr = { 1, 2, 3 };
+
+    int counter = 0;
+    auto iter = kissra::all(arr)
+                    .transform([&](int i) {
+                        ++counter;
+                        return std::to_string(i);
+                    })
+                    .cache_latest();
+
+    CHECK_EQ(*iter.front(), "1"s);
+    CHECK_EQ(*iter.front(), "1"s);
+    CHECK_EQ(*iter.next(), "1"s);
+    CHECK_EQ(counter, 1);
+
+    CHECK_EQ(*iter.back(), "3"s);
+    CHECK_EQ(*iter.next_back(), "3"s);
+    CHECK_EQ(counter, 2);
+
+    CHECK_EQ(*iter.nth(0), "2"s);
+    CHECK_EQ(*iter.next(), "2"s);
+    CHECK_EQ(counter, 3);
+
+    CHECK_FALSE(iter.next());
+}
+
+TEST_CASE("transform().filter() should evaluate the projection once per item on nth() + next()") {
+    std::array arr = { 1, 2, 3, 4 };
+
+    int counter = 0;
+    auto iter = kissra::all(arr)
+                    .transform([&](int i) {
+                        ++counter;
+                        return std::to_string(i);
+                    })
+                    .filter([](const std::string& s) { return (s.back() - '0') % 2 == 0; });
+
+    CHECK_EQ(*iter.front(), "2"s);
+    CHECK_EQ(*iter.next(), "2"s);
+    CHECK_EQ(counter, 2);
+
+    CHECK_EQ(*iter.nth(0), "4"s);
+    CHECK_EQ(*iter.next(), "4"s);
+    CHECK_EQ(counter, 4);
+
+    CHECK_FALSE(iter.next());
+    CHECK_EQ(counter, 4);
+}
+
+TEST_CASE("transform().drop_while().collect() should evaluate the projection once per item") {
+    std::array arr = { 1, 2, 3, 4 };
+
+    int counter = 0;
+    auto actual = kissra::all(arr)
+                      .transform([&](int i) {
+                          ++counter;
+                          return std::to_string(i);
+                      })
+                      .drop_while([](const std::string& s) { return s != "3"s; })
+                      .collect();
+
+    CHECK_EQ(actual, (std::vector{ "3"s, "4"s }));
+    CHECK_EQ(counter, 4);
+}
+
+TEST_CASE("transform().cache_latest().chunk() should evaluate the projection once per item") {
+    std::array arr = { 1, 2, 3, 4 };
+
+    int counter = 0;
+    auto chunks = kissra::all(arr)
+                      .transform([&](int i) {
+                          ++counter;
+                          return std::to_string(i);
+                      })
+                      .cache_latest()
+                      .chunk(2);
+
+    std::vector<std::vector<std::string>> actual;
+    while (auto chunk = chunks.next()) {
+        const auto peeked = chunk->front();
+        CHECK_EQ(*chunk->next(), *peeked);
+        actual.push_back(chunk->collect());
+    }
+
+    CHECK_EQ(actual, (std::vector{ std::vector{ "2"s }, std::vector{ "4"s } }));
+    CHECK_EQ(counter, 4);
+}
+
+TEST_CASE("transform().filter() should keep prvalue items which stay valid after the iterator moves on") {
+    std::array arr = { 1, 2, 3, 4 };
+
+    auto iter = kissra::all(arr).transform([](int i) { return std::to_string(i); }).filter([](const std::string&) { return true; });
+    static_assert(std::is_same_v<kissra::iter_reference_t<decltype(iter)>, std::string>);
+
+    auto peeked = iter.front();
+    auto first = iter.next();
+    auto second = iter.next();
+    CHECK_EQ(*peeked, "1"s);
+    CHECK_EQ(*first, "1"s);
+    CHECK_EQ(*second, "2"s);
+}
+
+TEST_CASE("transform().filter().nth(k) should only copy the returned item out of the cache") {
+    std::array arr = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    tracker tracker;
+    auto iter = kissra::all(arr)
+                    .transform([&](int i) { return std::pair{ i, noisy{ tracker } }; })
+                    .filter([](const std::pair<int, noisy>& p) { return p.first % 2 == 0; });
+
+    CHECK_EQ(iter.nth(2)->first, 6);
+    CHECK_EQ(tracker.copy_ctor, 1);
+    CHECK_EQ(iter.next()->first, 6);
+    iter.advance(1);
+    CHECK_FALSE(iter.next());
+    CHECK_EQ(tracker.copy_ctor, 1);
+}
+
+TEST_CASE("filter() over trivially destructible prvalues should not be cached") {
+    std::array arr = { 1, 2, 3, 4 };
+
+    auto iter = kissra::all(arr).transform([](int i) { return i * 2; }).filter(fn::gt_c<4>);
+    static_assert(std::is_same_v<kissra::iter_reference_t<decltype(iter)>, int>);
+
+    CHECK_EQ(iter.collect(), (std::vector{ 6, 8 }));
+}
+
+TEST_CASE("apply [kissra::compo::transform(...).cache_latest()] should work") {
+    std::array arr = { 1, 2, 3 };
+
+    int counter = 0;
+    auto comp = kissra::compo::transform([&](int i) {
+        ++counter;
+        return std::to_string(i);
+    }).cache_latest();
+    auto iter = kissra::apply(arr, comp);
+
+    CHECK_EQ(*iter.front(), "1"s);
+    CHECK_EQ(iter.collect(), (std::vector{ "1"s, "2"s, "3"s }));
+    CHECK_EQ(counter, 3);
+}
+} // namespace kissra::test
\ No newline at end of file
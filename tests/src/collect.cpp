@@ -3,11 +3,19 @@
 #include "kissra/kissra.hpp"
 #include "kissra/noisy.hpp"
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <deque>
 #include <forward_list>
 #include <iostream>
 #include <list>
+#include <map>
+#include <memory_resource>
 #include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -62,4 +70,193 @@ TEST_CASE("all(<rvalue references>).collect() should move and NOT copy") {
     CHECK_EQ(tracker.move_op, 0);
 }
 
+TEST_CASE("zip().unzip() should collect tuples into a tuple of vectors") {
+    std::array a = { 1, 2, 3 };
+    std::array b = { "a"s, "b"s, "c"s };
+    const auto [ints, strs] = kissra::all(a).zip(b).filter([](int x, const std::string&) { return x != 2; }).unzip();
+
+    CHECK_EQ(ints, (std::vector{ 1, 3 }));
+    CHECK_EQ(strs, (std::vector{ "a"s, "c"s }));
+}
+
+TEST_CASE("collect_soa<TTo>() should collect aggregates into a tuple of per-member containers") {
+    struct row {
+        int id;
+        double score;
+    };
+    std::array rows = { row{ 1, 0.5 }, row{ 2, 1.5 }, row{ 3, 2.5 } };
+    const auto [ids, scores] = kissra::all(rows).collect_soa<std::deque>();
+
+    CHECK_EQ(ids, (std::deque{ 1, 2, 3 }));
+    CHECK_EQ(scores, (std::deque{ 0.5, 1.5, 2.5 }));
+}
+
+TEST_CASE("collect_soa() should reserve containers for sized iterators") {
+    std::array a = { 1, 2, 3, 4 };
+    std::array b = { 5, 6, 7, 8 };
+    const auto [xs, ys] = kissra::all(a).zip(b).unzip();
+
+    CHECK_EQ(xs.capacity(), 4);
+    CHECK_EQ(ys.capacity(), 4);
+    CHECK_EQ(ys, (std::vector{ 5, 6, 7, 8 }));
+}
+
+TEST_CASE("all(<tuples of rvalue references>).unzip() should move and NOT copy") {
+    tracker tracker;
+    noisy noisy{ tracker };
+
+    std::array arr = { std::tuple<test::noisy&&, int>{ std::move(noisy), 1 } };
+    std::ignore = kissra::all(arr).unzip();
+
+    CHECK_EQ(tracker.copy_ctor, 0);
+    CHECK_EQ(tracker.move_ctor, 1);
+}
+
+TEST_CASE("zip(keys, values).collect_map() should collect pairs into std::unordered_map") {
+    std::array keys = { 1, 2, 3 };
+    std::array values = { "a"s, "b"s, "c"s };
+    const auto map = kissra::all(keys).zip(values).collect_map();
+
+    CHECK_EQ(map, (std::unordered_map<int, std::string>{ { 1, "a" }, { 2, "b" }, { 3, "c" } }));
+    CHECK_GE(map.bucket_count(), 3);
+}
+
+TEST_CASE("collect_map<TMap, on_duplicate>() should resolve duplicate keys according to the policy") {
+    std::array keys = { 1, 2, 1 };
+    std::array values = { "a"s, "b"s, "c"s };
+
+    CHECK_EQ(kissra::all(keys).zip(values).collect_map<std::map>(), (std::map<int, std::string>{ { 1, "a" }, { 2, "b" } }));
+    CHECK_EQ(kissra::all(keys).zip(values).collect_map<std::map, kissra::on_duplicate::keep_last>(),
+        (std::map<int, std::string>{ { 1, "c" }, { 2, "b" } }));
+    CHECK_EQ(kissra::all(keys).zip(values).collect_map<std::multimap>().size(), 3);
+    CHECK_THROWS_AS(std::ignore = kissra::all(keys).zip(values).collect_map<std::map, kissra::on_duplicate::error>(),
+        std::invalid_argument);
+}
+
+TEST_CASE("collect_map(key_proj, value_proj) should map projected keys onto projected values") {
+    std::array words = { "a"s, "bb"s, "cc"s, "ddd"s };
+    const auto map = kissra::all(words).collect_map(kissra::fn::size, [](const std::string& s) { return s + "!"; });
+
+    CHECK_EQ(map, (std::unordered_map<std::size_t, std::string>{ { 1, "a!" }, { 2, "bb!" }, { 3, "ddd!" } }));
+}
+
+TEST_CASE("collect_map(key_proj, value_proj) should project the key before value_proj moves out of an rvalue item") {
+    std::array numbers = { 1, 22, 333 };
+    const auto map = kissra::all(numbers)
+                         .transform([](int i) { return std::to_string(i); })
+                         .collect_map<std::map>([](const std::string& s) { return s; }, [](std::string&& s) { return std::move(s); });
+
+    CHECK_EQ(map, (std::map<std::string, std::string>{ { "1", "1" }, { "22", "22" }, { "333", "333" } }));
+}
+
+TEST_CASE("all(<pairs of rvalue references>).collect_map() should move and NOT copy") {
+    tracker tracker;
+    noisy noisy{ tracker };
+
+    std::array arr = { std::pair<int, test::noisy&&>{ 1, std::move(noisy) } };
+    std::ignore = kissra::all(arr).collect_map<std::map>();
+
+    CHECK_EQ(tracker.copy_ctor, 0);
+    CHECK_EQ(tracker.move_ctor, 1);
+}
+
+TEST_CASE("collect_set<TSet>() should collect unique items") {
+    std::array arr = { 3, 1, 3, 2, 1 };
+
+    CHECK_EQ(kissra::all(arr).collect_set(), (std::unordered_set{ 1, 2, 3 }));
+    CHECK_EQ(kissra::all(arr).collect_set<std::set>(), (std::set{ 1, 2, 3 }));
+}
+
+TEST_CASE("collect_static<N>() should collect up to N items into inline storage") {
+    std::array arr = { "a"s, "b"s, "c"s };
+    std::list lst = { 1, 2, 3 };
+
+    const auto strs = kissra::all(arr).collect_static<4>();
+    REQUIRE(strs);
+    CHECK_EQ(strs->size(), 3);
+    CHECK_EQ((*strs)[2], "c"s);
+    CHECK_FALSE(kissra::all(arr).collect_static<2>());
+
+    CHECK_EQ(kissra::all(lst).filter(kissra::fn::odd).collect_static<2>()->size(), 2);
+    CHECK_FALSE(kissra::all(lst).collect_static<2>());
+
+    CHECK(kissra::all(arr).drop(3).collect_static<0>()->empty());
+    CHECK_FALSE(kissra::all(arr).collect_static<0>());
+    CHECK_FALSE(kissra::all(lst).collect_static<0>());
+}
+
+TEST_CASE("collect_array<N>() should collect exactly N items into std::array") {
+    std::list lst = { 1, 2, 3 };
+
+    CHECK_EQ(kissra::all(lst).collect_array<3>(), (std::array{ 1, 2, 3 }));
+    CHECK_FALSE(kissra::all(lst).collect_array<2>());
+    CHECK_FALSE(kissra::all(lst).collect_array<4>());
+    CHECK(kissra::all(lst).drop(3).collect_array<0>());
+}
+
+TEST_CASE("collect(alloc) should construct the container with the allocator") {
+    std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+    std::array arr = { 1, 2, 3 };
+
+    const auto vec = kissra::all(arr).collect(std::pmr::polymorphic_allocator<int>{ &arena });
+    CHECK_EQ(vec, (std::pmr::vector<int>{ 1, 2, 3 }));
+    CHECK_EQ(vec.get_allocator().resource(), &arena);
+}
+
+TEST_CASE("collect_pmr(resource) should allocate the container and the owned strings from the resource") {
+    std::pmr::monotonic_buffer_resource arena;
+    std::array arr = { 1, 1'000'000'000, 3 };
+
+    const auto strs = kissra::all(arr).transform([](int x) { return std::to_string(x) + std::string(32, '!'); }).collect_pmr(&arena);
+    static_assert(std::same_as<std::remove_cvref_t<decltype(strs)>, std::pmr::vector<std::pmr::string>>);
+    REQUIRE_EQ(strs.size(), 3);
+    CHECK_EQ(strs[1].substr(0, 10), "1000000000");
+    CHECK_EQ(strs.get_allocator().resource(), &arena);
+    CHECK_EQ(strs[1].get_allocator().resource(), &arena);
+}
+
+TEST_CASE("collect_into(out) should replace the contents of out keeping its capacity") {
+    std::vector<int> out;
+    out.reserve(16);
+    const auto* data = out.data();
+    std::array arr = { 1, 2, 3, 4 };
+    std::list lst = { 5, 6 };
+
+    kissra::all(arr).collect_into(out);
+    CHECK_EQ(out, (std::vector{ 1, 2, 3, 4 }));
+    kissra::all(lst).collect_into(out);
+    CHECK_EQ(out, (std::vector{ 5, 6 }));
+    kissra::all(arr).filter(kissra::fn::even).collect_into(out);
+    CHECK_EQ(out, (std::vector{ 2, 4 }));
+    CHECK_EQ(out.data(), data);
+}
+
+TEST_CASE("append_into(out) should append the items to out") {
+    std::array arr = { 1, 2, 3, 4 };
+    std::deque<int> out = { 0 };
+    std::set<int> set = { 3 };
+
+    kissra::all(arr).drop(2).append_into(out);
+    kissra::all(arr).transform([](int x) { return x * 10; }).append_into(out);
+    CHECK_EQ(out, (std::deque{ 0, 3, 4, 10, 20, 30, 40 }));
+    CHECK_EQ(kissra::all(arr).append_into(set), (std::set{ 1, 2, 3, 4 }));
+}
+
+TEST_CASE("write_into(span) should write items until either runs out") {
+    std::array arr = { 1, 2, 3, 4, 5 };
+    std::array<int, 3> buf{};
+
+    auto iter = kissra::all(arr);
+    CHECK_EQ(iter.write_into(std::span{ buf }), 3);
+    CHECK_EQ(buf, (std::array{ 1, 2, 3 }));
+    CHECK_EQ(iter.write_into(std::span{ buf }), 2);
+    CHECK_EQ(buf, (std::array{ 4, 5, 3 }));
+
+    std::list lst = { 7, 8 };
+    CHECK_EQ(kissra::all(lst).write_into(std::span{ buf }), 2);
+    CHECK_EQ(buf, (std::array{ 7, 8, 3 }));
+    CHECK_EQ(kissra::all(arr).filter(kissra::fn::odd).write_into(std::span{ buf }.first(2)), 2);
+    CHECK_EQ(buf, (std::array{ 1, 3, 3 }));
+}
 } // namespace kissra::test
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+TEST_CASE("count() should return the number of remaining items") {
+    std::array arr = { 1, 2, 3, 4, 5 };
+    CHECK_EQ(kissra::all(arr).count(), 5);
+    CHECK_EQ(kissra::all(arr).drop(2).count(), 3);
+    CHECK_EQ(kissra::all(arr).filter(kissra::fn::odd).count(), 3);
+
+    std::list lst = { 1, 2, 3 };
+    CHECK_EQ(kissra::all(lst).filter(kissra::fn::odd).count(), 2);
+}
+
+TEST_CASE("count() should skip over items rather than evaluate them") {
+    std::array arr = { 1, 2, 3 };
+    int calls = 0;
+    auto iter = kissra::all(arr).transform([&](int x) {
+        ++calls;
+        return x;
+    });
+
+    CHECK_EQ(iter.count(), 3);
+    CHECK_EQ(calls, 0);
+}
+
+TEST_CASE("count_if(pred) should return the number of items pred holds for") {
+    std::array arr = { "a"s, "bb"s, "cc"s, "d"s };
+    CHECK_EQ(kissra::all(arr).count_if([](const std::string& s) { return s.size() == 2; }), 2);
+}
+
+TEST_CASE("count_if(fn::*) over many contiguous items should match std::count_if") {
+    std::vector<int> vec(100'003);
+    std::iota(vec.begin(), vec.end(), -50'000);
+
+    CHECK_EQ(kissra::all(vec).count_if(kissra::fn::gt_c<1'000>), std::size_t(std::ranges::count_if(vec, [](int x) { return x > 1'000; })));
+    CHECK_EQ(kissra::all(vec).count_if(kissra::fn::le(-3)), std::size_t(std::ranges::count_if(vec, [](int x) { return x <= -3; })));
+    CHECK_EQ(kissra::all(vec).count_if(kissra::fn::even), std::size_t(std::ranges::count_if(vec, [](int x) { return x % 2 == 0; })));
+    CHECK_EQ(kissra::all(vec).count_if(kissra::fn::divisible_by_c<7>), std::size_t(std::ranges::count_if(vec, [](int x) { return x % 7 == 0; })));
+    CHECK_EQ(kissra::all(vec).drop(10).count_if(kissra::fn::eq(-49'990)), 1);
+}
+
+TEST_CASE("filter().count_if(fn::*) should count items passing both predicates") {
+    std::vector<int> vec(1'000);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    CHECK_EQ(kissra::all(vec).filter(kissra::fn::even).count_if(kissra::fn::divisible_by_c<3>), 167);
+    CHECK_EQ(kissra::all(vec).transform([](int x) { return x * 3; }).count_if(kissra::fn::lt_c<30>), 10);
+}
+
+TEST_CASE("members<I>().count_if(fn::*) should work for contiguous aggregates") {
+    struct row {
+        std::string name;
+        double score;
+    };
+    std::vector<row> rows = { { "a", 0.5 }, { "b", 1.5 }, { "c", 2.5 } };
+    CHECK_EQ(kissra::all(rows).members<1>().count_if(kissra::fn::ge(1.5)), 2);
+}
+} // namespace kissra::test
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <array>
+#include <cstdint>
+#include <forward_list>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+TEST_CASE("distinct() should yield the first occurrence of every item in the original order") {
+    std::array arr = { 3, 1, 3, 2, 1, 4, 2, 3 };
+    REQUIRE_EQ(kissra::all(arr).distinct().collect(), (std::vector{ 3, 1, 2, 4 }));
+}
+
+TEST_CASE("distinct() over small integral items (bitmap) should handle the whole domain") {
+    std::vector<std::int8_t> items = { -128, 127, 0, -1, -128, 127, 5, 0 };
+    REQUIRE_EQ(kissra::all(items).distinct().collect(), (std::vector<std::int8_t>{ -128, 127, 0, -1, 5 }));
+
+    std::vector<std::uint16_t> wide = { 65535, 0, 65535, 1, 0 };
+    REQUIRE_EQ(kissra::distinct(wide).collect(), (std::vector<std::uint16_t>{ 65535, 0, 1 }));
+}
+
+TEST_CASE("distinct(capacity_hint) over strings should drop non-adjacent duplicates") {
+    std::forward_list words = { "b"s, "a"s, "b"s, "c"s, "a"s };
+    REQUIRE_EQ(kissra::all(words).distinct(8).collect(), (std::vector{ "b"s, "a"s, "c"s }));
+}
+
+TEST_CASE("distinct_by(proj) should yield items whose key is seen for the first time") {
+    std::array arr = { std::tuple{ 1, "one"s }, std::tuple{ 2, "two"s }, std::tuple{ 1, "uno"s }, std::tuple{ 3, "three"s } };
+    REQUIRE_EQ(kissra::all(arr).distinct_by(fn::member<0>).transform(fn::member<1>).collect(),
+        (std::vector{ "one"s, "two"s, "three"s }));
+}
+
+TEST_CASE("distinct().front() should not mark the item as seen") {
+    std::array arr = { 1, 1, 2, 1, 3 };
+    auto iter = kissra::all(arr).distinct();
+    REQUIRE_EQ(*iter.front(), 1);
+    REQUIRE_EQ(*iter.next(), 1);
+    REQUIRE_EQ(*iter.front(), 2);
+    REQUIRE_EQ(*iter.nth(1), 3);
+    REQUIRE_EQ(*iter.next(), 3);
+    REQUIRE_FALSE(iter.next());
+}
+
+TEST_CASE("distinct().count() should count unique items") {
+    std::vector<int> items;
+    for (int i = 0; i != 10'000; ++i) {
+        items.push_back(i % 1'234);
+    }
+    REQUIRE_EQ(kissra::all(items).distinct().count(), 1'234);
+}
+
+TEST_CASE("distinct().chunk(n) should yield chunks of unique items") {
+    std::array arr = { 1, 1, 2, 3, 2, 4, 5, 1 };
+    auto chunks = kissra::all(arr).distinct().chunk(2);
+
+    std::vector<std::vector<int>> actual;
+    while (auto chunk = chunks.next()) {
+        actual.push_back(chunk->collect());
+    }
+    REQUIRE_EQ(actual, (std::vector{ std::vector{ 1, 2 }, std::vector{ 3, 4 }, std::vector{ 5 } }));
+}
+
+TEST_CASE("distinct().split_at(n) parts should start out of the keys seen before them") {
+    std::array arr = { 0, 3, 1, 3, 2, 1, 4, 2 };
+    auto iter = kissra::all(arr).distinct();
+    REQUIRE_EQ(*iter.next(), 0);
+
+    auto [lhs, rhs] = std::move(iter).split_at(2);
+    REQUIRE_EQ(rhs.collect(), (std::vector{ 2, 4 }));
+    REQUIRE_EQ(lhs.collect(), (std::vector{ 3, 1 }));
+}
+
+TEST_CASE("apply [kissra::compo::distinct_by(...)] should work") {
+    std::array arr = { 10, 21, 12, 33, 44, 25 };
+    auto comp = kissra::compo::distinct_by([](int i) { return i % 2; }).transform([](int i) { return i * 2; });
+    REQUIRE_EQ(kissra::all(arr).apply(comp).collect(), (std::vector{ 20, 42 }));
+}
+} // namespace kissra::test
@@ -6,7 +6,9 @@
 #include <forward_list>
 #include <iostream>
 #include <list>
+#include <numeric>
 #include <set>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -69,4 +71,103 @@ TEST_CASE("find_not(value) returns nothing item if all values are what is being
     REQUIRE_FALSE(val);
 }
 
+TEST_CASE("find(value) over many contiguous items returns the first match and leaves the iterator right after it") {
+    std::vector<int> vec(10'000);
+    std::iota(vec.begin(), vec.end(), 0);
+    vec[7'777] = 42;
+    auto iter = kissra::all(vec).drop(43);
+
+    const auto val = iter.find(42);
+    REQUIRE(val);
+    REQUIRE_EQ(std::addressof(*val), std::addressof(vec[7'777]));
+    REQUIRE_EQ(*iter.next(), 7'778);
+    REQUIRE_FALSE(iter.find(42));
+    REQUIRE_FALSE(iter.next());
+}
+
+TEST_CASE("find(value) over bytes compares like the generic loop does") {
+    std::string str(5'000, 'a');
+    str[4'000] = 'z';
+    str[4'500] = char(-1);
+
+    REQUIRE_EQ(std::addressof(*kissra::all(str).find('z')), std::addressof(str[4'000]));
+    REQUIRE_EQ(std::addressof(*kissra::all(str).find(char(-1))), std::addressof(str[4'500]));
+    REQUIRE_FALSE(kissra::all(str).find('z' + 256));
+    REQUIRE(kissra::all(str).contains(int('a')));
+    REQUIRE_EQ(std::addressof(*kissra::all(str).find_not('a')), std::addressof(str[4'000]));
+}
+
+TEST_CASE("find_if(fn::*) over filtered contiguous items returns the first item passing both predicates") {
+    std::vector<int> vec(1'000);
+    std::iota(vec.begin(), vec.end(), 0);
+    auto iter = kissra::all(vec).filter(kissra::fn::divisible_by_c<7>);
+
+    const auto val = iter.find_if(kissra::fn::gt_c<500>);
+    REQUIRE_EQ(std::addressof(*val), std::addressof(vec[504]));
+    REQUIRE_EQ(*iter.next(), 511);
+    REQUIRE_EQ(*kissra::all(vec).find_if_not(kissra::fn::lt(900)), 900);
+    REQUIRE(kissra::all(vec).contains_if(kissra::fn::eq_c<999>));
+    REQUIRE_FALSE(kissra::all(vec).contains_if(kissra::fn::eq_c<1'000>));
+}
+
+TEST_CASE("find(value) over contiguous pointers returns the first match") {
+    std::array<int, 3> targets{};
+    std::vector<const int*> ptrs(300, &targets[0]);
+    ptrs[150] = &targets[2];
+
+    REQUIRE_EQ(std::addressof(*kissra::all(ptrs).find(&targets[2])), std::addressof(ptrs[150]));
+    REQUIRE_FALSE(kissra::all(ptrs).contains(&targets[1]));
+}
+
+TEST_CASE("find_last(value) returns the last match and leaves the iterator right before it") {
+    std::vector<int> vec(1'000, 0);
+    vec[10] = vec[300] = 1;
+    auto iter = kissra::all(vec);
+
+    const auto val = iter.find_last(1);
+    REQUIRE_EQ(std::addressof(*val), std::addressof(vec[300]));
+    REQUIRE_EQ(iter.size(), 300);
+    REQUIRE_EQ(std::addressof(*iter.find_last_if(kissra::fn::gt_c<0>)), std::addressof(vec[10]));
+    REQUIRE_FALSE(iter.find_last(1));
+    REQUIRE_EQ(iter.size(), 0);
+
+    std::list lst = { 1, 2, 1, 3 };
+    REQUIRE_EQ(std::addressof(*kissra::all(lst).find_last(1)), std::addressof(*std::next(lst.begin(), 2)));
+}
+
+TEST_CASE("position(value)/find_index(pred) return the position counting from the current front") {
+    std::vector<int> vec(1'000);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    REQUIRE_EQ(kissra::all(vec).drop(100).position(250), 150);
+    REQUIRE_FALSE(kissra::all(vec).position(1'000));
+    REQUIRE_EQ(kissra::all(vec).find_index(kissra::fn::ge_c<999>), 999);
+    REQUIRE_EQ(kissra::all(vec).filter(kissra::fn::even).position(10), 5);
+
+    std::list lst = { 3, 1, 4 };
+    auto iter = kissra::all(lst);
+    REQUIRE_EQ(iter.find_index(kissra::fn::even), 2);
+    REQUIRE_FALSE(iter.next());
+}
+
+TEST_CASE("find over contiguous items should call user functors only up to the found item") {
+    std::vector<int> vec(200);
+    std::iota(vec.begin(), vec.end(), 0);
+    int transform_calls = 0;
+    int filter_calls = 0;
+
+    auto transformed = kissra::all(vec).transform([&](int x) {
+        ++transform_calls;
+        return x;
+    });
+    REQUIRE_EQ(*transformed.find(3), 3);
+    REQUIRE_EQ(transform_calls, 4);
+
+    auto filtered = kissra::all(vec).filter([&](int x) {
+        ++filter_calls;
+        return x % 2 == 0;
+    });
+    REQUIRE_EQ(*filtered.find_if(kissra::fn::gt_c<5>), 6);
+    REQUIRE_EQ(filter_calls, 7);
+}
 } // namespace kissra::test
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+TEST_CASE("group_by(key_proj).aggregate(agg) should aggregate items per key in the order of their first occurrence") {
+    std::array words = { "apple"s, "bob"s, "avocado"s, "cat"s, "banana"s };
+    const auto counts = kissra::all(words).group_by([](const std::string& s) { return s[0]; }).aggregate(kissra::agg::count);
+
+    REQUIRE_EQ(counts.size(), 3);
+    CHECK_EQ(counts.begin()->first, 'a');
+    CHECK_EQ(counts.find('a')->second, 2);
+    CHECK_EQ(counts.find('b')->second, 2);
+    CHECK_EQ(counts.find('c')->second, 1);
+    CHECK_FALSE(counts.contains('d'));
+}
+
+TEST_CASE("zip(keys, values).group_by(fn::member<0>).aggregate(aggs...) should produce a tuple of results per key") {
+    std::array keys = { 1, 2, 1, 2, 1 };
+    std::array values = { 10, 20, 30, 40, 50 };
+    const auto groups = kissra::all(keys)
+                            .zip(values)
+                            .group_by(kissra::fn::member<0>)
+                            .aggregate(kissra::agg::count(kissra::fn::member<1>),
+                                kissra::agg::sum(kissra::fn::member<1>),
+                                kissra::agg::min(kissra::fn::member<1>),
+                                kissra::agg::max(kissra::fn::member<1>),
+                                kissra::agg::mean(kissra::fn::member<1>));
+
+    CHECK_EQ(groups.find(1)->second, std::tuple{ 3uz, 90, 10, 50, 30.0 });
+    CHECK_EQ(groups.find(2)->second, std::tuple{ 2uz, 60, 20, 40, 30.0 });
+}
+
+TEST_CASE("group_by over many items should match std::map based grouping") {
+    std::vector<int> vec(100'000);
+    for (std::size_t i = 0; i != vec.size(); ++i) {
+        vec[i] = int((i * 7'919) % 1'009);
+    }
+
+    std::map<int, long long> expected;
+    for (int x : vec) {
+        expected[x % 97] += x;
+    }
+
+    const auto sums = kissra::all(vec).group_by([](int x) { return x % 97; }).aggregate(kissra::agg::sum);
+    REQUIRE_EQ(sums.size(), expected.size());
+    for (const auto& [key, sum] : expected) {
+        CHECK_EQ(sums.find(key)->second, sum);
+    }
+}
+
+TEST_CASE("reduce_by_key(key_proj, value_proj, op) should fold values per key") {
+    std::list<std::pair<std::string, std::string>> pairs = { { "x", "a" }, { "y", "b" }, { "x", "c" } };
+    const auto joined = kissra::all(pairs).values().reduce_by_key(kissra::fn::size, std::identity{}, std::plus<>{});
+    CHECK_EQ(joined.find(1)->second, "abc"s);
+
+    const auto by_key = kissra::all(pairs).reduce_by_key(kissra::fn::member<0>, kissra::fn::member<1>, std::plus<>{});
+    CHECK_EQ(by_key.find("x"s)->second, "ac"s);
+    CHECK_EQ(by_key.find("y"s)->second, "b"s);
+}
+} // namespace kissra::test
\ No newline at end of file
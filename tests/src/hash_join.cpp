@@ -0,0 +1,124 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <array>
+#include <list>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+struct event {
+    int user_id;
+    std::string what;
+};
+
+struct user {
+    int id;
+    std::string name;
+};
+
+TEST_CASE("hash_join(build, build_key, probe_key) should yield (probe, build) pairs per match in the probe order") {
+    std::array events = { event{ 2, "login" }, event{ 7, "login" }, event{ 1, "buy" }, event{ 2, "logout" } };
+    std::vector users = { user{ 1, "ann" }, user{ 2, "bob" }, user{ 3, "cid" } };
+
+    auto joined = kissra::all(events)
+                      .hash_join(users, &user::id, &event::user_id)
+                      .transform([](const event& e, const user& u) { return u.name + ":" + e.what; })
+                      .collect();
+    REQUIRE_EQ(joined, (std::vector{ "bob:login"s, "ann:buy"s, "bob:logout"s }));
+}
+
+TEST_CASE("hash_join(...) should yield references to both sides") {
+    std::array events = { event{ 1, "buy" } };
+    std::vector users = { user{ 1, "ann" } };
+
+    auto iter = kissra::all(events).hash_join(users, &user::id, &event::user_id);
+    auto [e, u] = *iter.next();
+    CHECK_EQ(&e, &events[0]);
+    CHECK_EQ(&u, &users[0]);
+    CHECK_FALSE(iter.next());
+}
+
+TEST_CASE("hash_join(...) should yield every build item with the key (in the build order)") {
+    std::array probe = { 1, 2, 3 };
+    std::list<std::pair<int, char>> build = { { 1, 'a' }, { 3, 'x' }, { 1, 'b' }, { 1, 'c' } };
+
+    auto iter = kissra::all(probe).hash_join(build, fn::member<0>, [](int i) { return i; });
+    std::string letters;
+    while (auto item = iter.next()) {
+        letters += std::get<1>(*item).second;
+    }
+    CHECK_EQ(letters, "abcx");
+}
+
+TEST_CASE("hash_join(...) over prvalue build items should store them") {
+    std::array probe = { 4, 5, 6, 7 };
+    std::array build = { 1, 2, 3 };
+
+    auto squares = kissra::all(build).transform([](int i) { return std::pair{ i * i, "sq"s + std::to_string(i) }; });
+    auto names = kissra::all(probe)
+                     .hash_join(std::move(squares), fn::member<0>, [](int i) { return i; })
+                     .transform([](int, const auto& square) { return square.second; })
+                     .collect();
+    CHECK_EQ(names, (std::vector{ "sq2"s }));
+}
+
+TEST_CASE("hash_join<left_semi>(...) and hash_join<left_anti>(...) should filter probe items by key presence") {
+    std::vector<int> probe;
+    for (int i = 0; i != 1'000; ++i) {
+        probe.push_back(i % 10);
+    }
+    std::array build = { 3, 3, 5 };
+
+    auto semi = kissra::all(probe).hash_join<join_kind::left_semi>(build, std::identity{}, std::identity{});
+    CHECK_EQ(semi.count(), 200);
+    CHECK_EQ(*kissra::all(probe).hash_join<join_kind::left_semi>(build, std::identity{}, std::identity{}).nth(1), 5);
+
+    auto anti = kissra::all(probe).hash_join<join_kind::left_anti>(build, std::identity{}, std::identity{}).collect();
+    CHECK_EQ(anti.size(), 800);
+    CHECK_EQ(&kissra::all(probe).hash_join<join_kind::left_anti>(build, std::identity{}, std::identity{}).front().value(), &probe[0]);
+}
+
+TEST_CASE("nth(n) and advance(n) over hash_join(...) should step over single matches") {
+    std::array probe = { 1, 2 };
+    std::array build = { std::pair{ 1, 'a' }, std::pair{ 1, 'b' }, std::pair{ 2, 'c' }, std::pair{ 1, 'd' } };
+
+    auto iter = kissra::all(probe).hash_join(build, fn::member<0>, std::identity{});
+    CHECK_EQ(std::get<1>(*iter.nth(0)).second, 'a');
+    CHECK_EQ(std::get<1>(*iter.nth(2)).second, 'd');
+    CHECK_EQ(iter.advance(5), 2);
+    CHECK_FALSE(iter.next());
+}
+
+TEST_CASE("hash_join(...) over a transformed contiguous probe should call the transform once per probe item") {
+    std::vector<int> probe(200);
+    for (int i = 0; i != 200; ++i) {
+        probe[i] = i % 10;
+    }
+    std::array build = { 3, 5 };
+
+    int calls = 0;
+    auto iter = kissra::all(probe)
+                    .transform([&](int i) {
+                        ++calls;
+                        return i;
+                    })
+                    .hash_join<join_kind::left_semi>(build, std::identity{}, std::identity{});
+    CHECK_EQ(*iter.next(), 3);
+    CHECK_EQ(calls, 4);
+    CHECK_EQ(iter.count(), 39);
+    CHECK_EQ(calls, 200);
+}
+
+TEST_CASE("apply [kissra::compo::hash_join(...)] should work") {
+    std::array probe = { 1, 2, 3, 4 };
+    std::array build = { 2, 4 };
+
+    auto comp = kissra::compo::hash_join<join_kind::left_anti>(build, std::identity{}, std::identity{});
+    CHECK_EQ(kissra::all(probe).apply(comp).collect(), (std::vector{ 1, 3 }));
+}
+} // namespace kissra::test
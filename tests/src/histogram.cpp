@@ -0,0 +1,96 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+TEST_CASE("value_counts() over 8-bit items should count every item (ascending keys)") {
+    std::string text = "abracadabra";
+    const auto counts = kissra::all(text).value_counts();
+
+    REQUIRE_EQ(counts.size(), 5);
+    CHECK_EQ(counts.begin()->first, 'a');
+    CHECK_EQ(counts.find('a')->second, 5);
+    CHECK_EQ(counts.find('b')->second, 2);
+    CHECK_EQ(counts.find('r')->second, 2);
+    CHECK_EQ(counts.find('c')->second, 1);
+    CHECK_EQ(counts.find('d')->second, 1);
+}
+
+TEST_CASE("value_counts() over signed 16-bit items should handle the whole domain") {
+    std::list<std::int16_t> items = { -32768, 32767, -32768, 0, 32767, -32768 };
+    const auto counts = kissra::all(items).value_counts();
+
+    REQUIRE_EQ(counts.size(), 3);
+    CHECK_EQ(counts.begin()->first, -32768);
+    CHECK_EQ(counts.find(-32768)->second, 3);
+    CHECK_EQ(counts.find(32767)->second, 2);
+    CHECK_EQ(counts.find(0)->second, 1);
+}
+
+TEST_CASE("value_counts() over contiguous wide integers of a small range should count densely") {
+    std::vector<std::int64_t> items;
+    for (std::int64_t i = 0; i != 100'000; ++i) {
+        items.push_back(std::numeric_limits<std::int64_t>::max() - i % 1'000);
+    }
+    const auto counts = kissra::all(items).value_counts();
+
+    REQUIRE_EQ(counts.size(), 1'000);
+    CHECK_EQ(counts.begin()->first, std::numeric_limits<std::int64_t>::max() - 999);
+    CHECK_EQ(counts.find(std::numeric_limits<std::int64_t>::max())->second, 100);
+}
+
+TEST_CASE("value_counts() over items of a wide range should count them in the order of first occurrence") {
+    std::array items = { 1'000'000, -5, 1'000'000, 7, -5, 1'000'000 };
+    const auto counts = kissra::all(items).value_counts();
+
+    REQUIRE_EQ(counts.size(), 3);
+    CHECK_EQ(counts.begin()->first, 1'000'000);
+    CHECK_EQ(counts.find(1'000'000)->second, 3);
+    CHECK_EQ(counts.find(-5)->second, 2);
+    CHECK_EQ(counts.find(7)->second, 1);
+}
+
+TEST_CASE("value_counts(proj) should count projected keys") {
+    std::array words = { "kiss"s, "ra"s, "is"s, "a"s, "lib"s };
+    const auto counts = kissra::all(words).value_counts([](const std::string& s) { return s.size(); });
+
+    REQUIRE_EQ(counts.size(), 4);
+    CHECK_EQ(counts.find(2uz)->second, 2);
+    CHECK_EQ(counts.find(4uz)->second, 1);
+}
+
+TEST_CASE("histogram(bins, lo, hi) should count items per equal-width bin and skip out of range ones") {
+    std::array items = { 0.0, 0.5, 2.5, 9.99, 10.0, -1.0, 11.0, 5.0 };
+    REQUIRE_EQ(kissra::all(items).histogram(5, 0.0, 10.0), (std::vector<std::size_t>{ 2, 1, 1, 0, 2 }));
+}
+
+TEST_CASE("histogram(bins) should span the range of the items") {
+    std::vector<int> items;
+    for (int i = 0; i != 1'000; ++i) {
+        items.push_back(i % 100);
+    }
+    const auto bins = kissra::all(items).histogram(4);
+
+    REQUIRE_EQ(bins.size(), 4);
+    CHECK_EQ(bins[0], 250);
+    CHECK_EQ(bins[1] + bins[2] + bins[3], 750);
+
+    std::vector<double> empty;
+    CHECK_EQ(kissra::all(empty).histogram(3), (std::vector<std::size_t>{ 0, 0, 0 }));
+}
+
+TEST_CASE("histogram(0, ...) should throw") {
+    std::array items = { 1, 2, 3 };
+    CHECK_THROWS_AS((void)kissra::all(items).histogram(0, 0.0, 1.0), std::invalid_argument);
+}
+} // namespace kissra::test
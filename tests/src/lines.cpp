@@ -0,0 +1,87 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace {
+struct temp_file {
+    temp_file(std::string_view name, std::string_view content)
+        : path(std::filesystem::temp_directory_path() / name) {
+        std::ofstream{ path, std::ios::binary } << content;
+    }
+
+    ~temp_file() {
+        std::filesystem::remove(path);
+    }
+
+    std::filesystem::path path;
+};
+} // namespace
+
+TEST_CASE("lines(text) should follow std::getline semantics") {
+    CHECK_EQ(kissra::lines(""sv).collect(), (std::vector<std::string_view>{}));
+    CHECK_EQ(kissra::lines("\n"sv).collect(), (std::vector{ ""sv }));
+    CHECK_EQ(kissra::lines("a\nb"sv).collect(), (std::vector{ "a"sv, "b"sv }));
+    CHECK_EQ(kissra::lines("a\nb\n"sv).collect(), (std::vector{ "a"sv, "b"sv }));
+    CHECK_EQ(kissra::lines("a\n\nb\n\n"sv).collect(), (std::vector{ "a"sv, ""sv, "b"sv, ""sv }));
+}
+
+TEST_CASE("lines(text).reverse() should yield the same lines backward") {
+    CHECK_EQ(kissra::lines("a\n\nb\n"sv).reverse().collect(), (std::vector{ "b"sv, ""sv, "a"sv }));
+    CHECK_EQ(kissra::lines("\n"sv).reverse().collect(), (std::vector{ ""sv }));
+}
+
+TEST_CASE("mmap_lines(path) should yield the lines of a file") {
+    temp_file file{ "kissra_mmap_lines.txt", "first\nsecond\n\nfourth\n" };
+
+    auto iter = kissra::mmap_lines(file.path);
+    CHECK_EQ(iter.bytes().size(), 21);
+    CHECK_EQ(iter.collect(), (std::vector{ "first"sv, "second"sv, ""sv, "fourth"sv }));
+}
+
+TEST_CASE("mmap_lines(path).bytes() should span the remaining lines") {
+    temp_file file{ "kissra_mmap_lines_bytes.txt", "first\nsecond\nlast" };
+
+    auto iter = kissra::mmap_lines(file.path);
+    CHECK_EQ(*iter.next(), "first"sv);
+    CHECK_EQ(std::string_view{ iter.bytes().data(), iter.bytes().size() }, "second\nlast"sv);
+    CHECK_EQ(*iter.next_back(), "last"sv);
+    CHECK_EQ(std::string_view{ iter.bytes().data(), iter.bytes().size() }, "second\n"sv);
+}
+
+TEST_CASE("mmap_lines(mapped_file) lines should stay valid as long as the mapping does") {
+    temp_file file{ "kissra_mmap_lines_mapping.txt", "first\nsecond\n" };
+    const kissra::mapped_file mapping{ file.path };
+
+    const auto lines = kissra::mmap_lines(mapping).collect();
+    CHECK_EQ(lines, (std::vector{ "first"sv, "second"sv }));
+}
+
+TEST_CASE("mmap_lines(path).reverse().take(N) should read the tail of a file") {
+    temp_file file{ "kissra_mmap_lines_tail.txt", "1\n2\n3\n4\n5" };
+
+    CHECK_EQ(kissra::mmap_lines(file.path).reverse().take(2).collect(), (std::vector{ "5"sv, "4"sv }));
+}
+
+TEST_CASE("mmap_lines(path) of an empty file should yield nothing") {
+    temp_file file{ "kissra_mmap_lines_empty.txt", "" };
+
+    auto iter = kissra::mmap_lines(file.path);
+    CHECK(iter.bytes().empty());
+    CHECK_FALSE(iter.next());
+}
+
+TEST_CASE("mmap_lines(path) of a non-existent file should throw") {
+    CHECK_THROWS_AS(kissra::mmap_lines("/non/existent/kissra/file"), std::system_error);
+}
+} // namespace kissra::test
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+namespace {
+constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+}
+
+TEST_CASE("min() / max() should return the least / greatest item") {
+    std::array arr = { 5, 1, 9, 3, 7 };
+    CHECK_EQ(*kissra::all(arr).min(), 1);
+    CHECK_EQ(*kissra::all(arr).max(), 9);
+}
+
+TEST_CASE("min() / max() / minmax() / argmin() of nothing should return nothing") {
+    std::vector<int> vec;
+    CHECK_FALSE(kissra::all(vec).min());
+    CHECK_FALSE(kissra::all(vec).max());
+    CHECK_FALSE(kissra::all(vec).minmax());
+    CHECK_FALSE(kissra::all(vec).argmin());
+}
+
+TEST_CASE("min() / max() / argmin() / argmax() over many contiguous items should match scalar results") {
+    std::vector<int> vec(1'003);
+    for (std::size_t i = 0; i != vec.size(); ++i) {
+        vec[i] = int((i * 7919) % 1'000) - 500;
+    }
+    vec[777] = -1'000;
+    vec[901] = -1'000;
+    vec[13] = 1'000;
+    vec[1'002] = 1'000;
+
+    CHECK_EQ(*kissra::all(vec).min(), -1'000);
+    CHECK_EQ(*kissra::all(vec).max(), 1'000);
+    CHECK_EQ(*kissra::all(vec).argmin(), 777);
+    CHECK_EQ(*kissra::all(vec).argmax(), 13);
+    CHECK_EQ(*kissra::all(vec).minmax(), std::pair{ -1'000, 1'000 });
+    CHECK_EQ(*kissra::all(vec).drop(14).argmax(), 1'002 - 14);
+}
+
+TEST_CASE("min() / max() should treat extreme values of integral types properly") {
+    std::array arr = { std::numeric_limits<int>::max(), std::numeric_limits<int>::max() };
+    CHECK_EQ(*kissra::all(arr).min(), std::numeric_limits<int>::max());
+    CHECK_EQ(*kissra::all(arr).argmin(), 0);
+}
+
+TEST_CASE("filter().min() / minmax() should work for non-contiguous iterators") {
+    std::array arr = { 5, 1, 9, 3, 7, 2 };
+    CHECK_EQ(*kissra::all(arr).filter(kissra::fn::odd).min(), 1);
+    CHECK_EQ(*kissra::all(arr).filter(kissra::fn::odd).argmax(), 2);
+    CHECK_EQ(*kissra::all(arr).filter(kissra::fn::even).minmax(), std::pair{ 2, 2 });
+}
+
+TEST_CASE("members<I>().min() / max() should work for contiguous aggregates") {
+    struct row {
+        std::string name;
+        double score;
+    };
+    std::vector<row> rows;
+    for (int i = 0; i != 100; ++i) {
+        rows.push_back(row{ std::to_string(i), double((i * 37) % 100) });
+    }
+
+    CHECK_EQ(*kissra::all(rows).members<1>().min(), 0.0);
+    CHECK_EQ(*kissra::all(rows).members<1>().max(), 99.0);
+    CHECK_EQ(*kissra::all(rows).members<1>().argmin(), 0);
+    CHECK_EQ(*kissra::all(rows).members<1>().minmax(), std::pair{ 0.0, 99.0 });
+}
+
+TEST_CASE("min_by(proj) / max_by(proj) should return the (first) item with the least / greatest key") {
+    std::array arr = { "ccc"s, "a"s, "dddd"s, "b"s, "eeee"s };
+    CHECK_EQ(*kissra::all(arr).min_by(kissra::fn::size), "a"s);
+    CHECK_EQ(*kissra::all(arr).max_by(kissra::fn::size), "dddd"s);
+}
+
+TEST_CASE("min_by(proj) / max_by(proj) should project every item once") {
+    std::array arr = { "ccc"s, "a"s, "dddd"s, "b"s, "eeee"s };
+
+    int calls = 0;
+    const auto counted_size = [&](const std::string& s) {
+        ++calls;
+        return s.size();
+    };
+    CHECK_EQ(*kissra::all(arr).min_by(counted_size), "a"s);
+    CHECK_EQ(calls, 5);
+    CHECK_EQ(*kissra::all(arr).max_by(counted_size), "dddd"s);
+    CHECK_EQ(calls, 10);
+}
+
+TEST_CASE("nan_policy::skip should ignore NaNs") {
+    std::vector vec = { nan, 3.0, nan, 1.0, 2.0, nan, 5.0, 4.0, 0.5, nan, 6.0 };
+    CHECK_EQ(*kissra::all(vec).min(), 0.5);
+    CHECK_EQ(*kissra::all(vec).max(), 6.0);
+    CHECK_EQ(*kissra::all(vec).argmin(), 8);
+    CHECK_EQ(*kissra::all(vec).minmax(), std::pair{ 0.5, 6.0 });
+    CHECK_EQ(*kissra::all(vec).filter([](double) { return true; }).min(), 0.5);
+
+    std::vector only_nans = { nan, nan };
+    CHECK_FALSE(kissra::all(only_nans).min());
+    CHECK_FALSE(kissra::all(only_nans).minmax());
+}
+
+TEST_CASE("nan_policy::propagate should return the first NaN") {
+    std::vector vec = { 3.0, 1.0, 2.0, 5.0, 4.0, 0.5, 7.0, 8.0, 9.0, nan, 6.0, nan };
+    CHECK(std::isnan(*kissra::all(vec).min<kissra::nan_policy::propagate>()));
+    CHECK(std::isnan(kissra::all(vec).minmax<kissra::nan_policy::propagate>()->first));
+    CHECK_EQ(*kissra::all(vec).argmax<kissra::nan_policy::propagate>(), 9);
+    CHECK_EQ(*kissra::all(vec).filter([](double) { return true; }).argmin<kissra::nan_policy::propagate>(), 9);
+}
+} // namespace kissra::test
\ No newline at end of file
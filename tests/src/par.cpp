@@ -0,0 +1,131 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kissra::test {
+namespace {
+std::vector<std::int64_t> iota(std::int64_t n) {
+    std::vector<std::int64_t> items(n);
+    std::iota(items.begin(), items.end(), std::int64_t{ 0 });
+    return items;
+}
+} // namespace
+
+TEST_CASE("par().sum() and par().count_if(pred) should match the sequential results") {
+    kissra::thread_pool pool{ 4 };
+    auto items = iota(1'000'003);
+
+    CHECK_EQ(kissra::all(items).par(pool).sum(), kissra::all(items).sum());
+    CHECK_EQ(kissra::all(items).transform([](std::int64_t i) { return i * i; }).par(pool).sum(), 333'335'833'339'500'005);
+    CHECK_EQ(kissra::all(items).par(pool).count_if(fn::even), 500'002);
+    CHECK_EQ(kissra::all(items).filter(fn::divisible_by(3)).par(pool).count(), 333'335);
+    CHECK_EQ(kissra::par(items, pool).count(), items.size());
+}
+
+TEST_CASE("par().sum() over floating-point items should not depend on the number of threads") {
+    std::vector<double> items;
+    for (int i = 0; i != 300'000; ++i) {
+        items.push_back(1.0 / (i + 1));
+    }
+    kissra::thread_pool single{ 1 };
+    kissra::thread_pool several{ 8 };
+    CHECK_EQ(kissra::all(items).par(single).sum(), kissra::all(items).par(several).sum());
+}
+
+TEST_CASE("par().min() and par().max() should find the extremes of the first occurrence") {
+    kissra::thread_pool pool{ 4 };
+    auto items = iota(100'000);
+    items[77'777] = -5;
+    items[12'345] = 1'000'000;
+
+    CHECK_EQ(kissra::all(items).par(pool).min(), -5);
+    CHECK_EQ(kissra::all(items).par(pool).max(), 1'000'000);
+
+    std::vector<std::int64_t> empty;
+    CHECK_FALSE(kissra::all(empty).par(pool).min());
+}
+
+TEST_CASE("par().reduce(identity, op) should fold zipped items") {
+    kissra::thread_pool pool{ 4 };
+    auto lhs = iota(50'000);
+    auto rhs = iota(60'000);
+
+    const auto dot = kissra::all(lhs)
+                         .zip(rhs)
+                         .transform([](std::int64_t l, std::int64_t r) { return l * r; })
+                         .par(pool)
+                         .reduce(std::int64_t{ 0 }, std::plus{});
+    CHECK_EQ(dot, 41'665'416'675'000);
+}
+
+TEST_CASE("par() over chunk(n) should evaluate whole chunks within a piece") {
+    kissra::thread_pool pool{ 4 };
+    auto items = iota(100'000);
+
+    auto chunk_sums = kissra::all(items).chunk(1'000).transform([](auto chunk) { return chunk.sum(); });
+    CHECK_EQ(chunk_sums.par(pool).max(), 99'499'500);
+    CHECK_EQ(kissra::all(items).chunk(1'000).par(pool).count(), 100);
+}
+
+TEST_CASE("par().for_each(fn) should visit every item once") {
+    kissra::thread_pool pool{ 4 };
+    std::vector<std::pair<int, std::string>> items;
+    for (int i = 0; i != 20'000; ++i) {
+        items.emplace_back(i, std::to_string(i));
+    }
+
+    std::atomic<std::int64_t> total = 0;
+    kissra::all(items).keys().filter(fn::odd).par(pool).for_each([&](int i) { total += i; });
+    CHECK_EQ(total.load(), 100'000'000);
+}
+
+TEST_CASE("par().collect() should preserve the source order") {
+    kissra::thread_pool pool{ 4 };
+    auto items = iota(300'000);
+
+    auto squares = kissra::all(items).transform([](std::int64_t i) { return i * i; });
+    CHECK_EQ(squares.par(pool).collect(), squares.collect());
+
+    auto filtered = kissra::all(items).filter(fn::divisible_by(7)).transform([](std::int64_t i) { return std::to_string(i); });
+    const auto strings = filtered.par(pool).collect();
+    REQUIRE_EQ(strings.size(), 42'858);
+    CHECK_EQ(strings.front(), "0");
+    CHECK_EQ(strings[1], "7");
+    CHECK_EQ(strings.back(), "299999");
+    CHECK_EQ(strings, filtered.collect());
+
+    const auto deque = kissra::all(items).filter(fn::odd).par(pool).collect<std::deque>();
+    REQUIRE_EQ(deque.size(), 150'000);
+    CHECK_EQ(deque.front(), 1);
+    CHECK_EQ(deque.back(), 299'999);
+}
+
+TEST_CASE("thread_pool{ 0 } should run everything on the calling thread") {
+    kissra::thread_pool pool{ 0 };
+    auto items = iota(10'000);
+    CHECK_EQ(pool.concurrency(), 1);
+    CHECK_EQ(kissra::all(items).par(pool).sum(), 49'995'000);
+}
+
+TEST_CASE("par() should rethrow an exception thrown by a functor") {
+    kissra::thread_pool pool{ 4 };
+    auto items = iota(100'000);
+    auto iter = kissra::all(items).transform([](std::int64_t i) {
+        if (i == 54'321) {
+            throw std::runtime_error("boom");
+        }
+        return i;
+    });
+    CHECK_THROWS_AS((void)iter.par(pool).sum(), std::runtime_error);
+}
+} // namespace kissra::test
@@ -0,0 +1,78 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+TEST_CASE("partition_into(k, key_fn) should scatter items preserving their relative order") {
+    std::array arr = { 5, 1, 8, 3, 4, 6, 7, 2 };
+    const auto parts = kissra::all(arr).partition_into(3, [](int x) { return x % 3; });
+
+    REQUIRE_EQ(parts.size(), 3);
+    CHECK_EQ(parts[0], (std::vector{ 3, 6 }));
+    CHECK_EQ(parts[1], (std::vector{ 1, 4, 7 }));
+    CHECK_EQ(parts[2], (std::vector{ 5, 8, 2 }));
+}
+
+TEST_CASE("partition_into(k, key_fn) should flush staging blocks of many partitions") {
+    std::vector<std::uint32_t> vec(100'000);
+    std::iota(vec.begin(), vec.end(), 0u);
+
+    const auto parts = kissra::all(vec).partition_into(256, [](std::uint32_t x) { return (x * 2654435761u) >> 24; });
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i != parts.size(); ++i) {
+        total += parts[i].size();
+        CHECK(std::ranges::is_sorted(parts[i]));
+        CHECK(std::ranges::all_of(parts[i], [&](std::uint32_t x) { return (x * 2654435761u) >> 24 == i; }));
+    }
+    CHECK_EQ(total, vec.size());
+}
+
+TEST_CASE("partition_into<TTo>(k, key_fn) should work with non-staged items and other containers") {
+    std::array arr = { "a"s, "bb"s, "cc"s, "d"s, "eee"s };
+    const auto parts = kissra::all(arr).partition_into<std::list>(4, kissra::fn::size);
+
+    REQUIRE_EQ(parts.size(), 4);
+    CHECK(parts[0].empty());
+    CHECK_EQ(parts[1], (std::list{ "a"s, "d"s }));
+    CHECK_EQ(parts[2], (std::list{ "bb"s, "cc"s }));
+    CHECK_EQ(parts[3], (std::list{ "eee"s }));
+}
+
+TEST_CASE("filter().partition_into(k, key_fn) should work for unsized iterators") {
+    std::array arr = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    const auto parts = kissra::all(arr).filter(kissra::fn::odd).partition_into<std::deque>(2, [](int x) { return x > 4; });
+
+    REQUIRE_EQ(parts.size(), 2);
+    CHECK_EQ(parts[0], (std::deque{ 1, 3 }));
+    CHECK_EQ(parts[1], (std::deque{ 5, 7, 9 }));
+}
+
+TEST_CASE("partition(pred) should return a pair of matching & non-matching items") {
+    std::array arr = { 1, 2, 3, 4, 5, 6, 7 };
+    const auto [even, odd] = kissra::all(arr).partition(kissra::fn::even);
+
+    CHECK_EQ(even, (std::vector{ 2, 4, 6 }));
+    CHECK_EQ(odd, (std::vector{ 1, 3, 5, 7 }));
+}
+
+TEST_CASE("filter().partition(pred) should work for unsized iterators") {
+    std::array arr = { "a"s, "bb"s, "cc"s, "d"s, "eee"s };
+    const auto [short_strs, long_strs] = kissra::all(arr)
+                                             .filter([](const std::string& s) { return s != "cc"; })
+                                             .partition([](const std::string& s) { return s.size() < 2; });
+
+    CHECK_EQ(short_strs, (std::vector{ "a"s, "d"s }));
+    CHECK_EQ(long_strs, (std::vector{ "bb"s, "eee"s }));
+}
+} // namespace kissra::test
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+TEST_CASE("median() should interpolate between the middle items of an even number of them") {
+    std::array odd = { 5, 1, 3 };
+    std::array even = { 4, 1, 3, 2 };
+    CHECK_EQ(kissra::all(odd).median(), 3.0);
+    CHECK_EQ(kissra::all(even).median(), 2.5);
+    CHECK_EQ(kissra::all(even).median<quantile_method::exact>(), 2);
+}
+
+TEST_CASE("quantile(q) of no items should be empty") {
+    std::vector<double> empty;
+    CHECK_FALSE(kissra::all(empty).quantile(0.5));
+    CHECK_FALSE(kissra::all(empty).median());
+}
+
+TEST_CASE("quantile(q) should ignore NaNs") {
+    std::array items = { NAN, 1.0, NAN, 3.0 };
+    CHECK_EQ(kissra::all(items).median(), 2.0);
+}
+
+TEST_CASE("quantile(q) out of [0, 1] should throw") {
+    std::array items = { 1, 2, 3 };
+    CHECK_THROWS_AS((void)kissra::all(items).quantile(1.5), std::invalid_argument);
+    CHECK_THROWS_AS((void)kissra::all(items).quantile(-0.1), std::invalid_argument);
+}
+
+TEST_CASE("quantiles({...}) should match quantiles of the sorted items") {
+    std::mt19937 rng(42);
+    std::vector<int> samples(100'000);
+    for (auto& sample : samples) {
+        sample = static_cast<int>(rng() % 10'000);
+    }
+    auto sorted = samples;
+    std::ranges::sort(sorted);
+
+    const auto linear = kissra::all(samples).quantiles({ 0.5, 0.9, 0.99, 0.999 });
+    REQUIRE(linear);
+    for (std::size_t i = 0; const double q : { 0.5, 0.9, 0.99, 0.999 }) {
+        const double h = (sorted.size() - 1) * q;
+        const auto lo = static_cast<std::size_t>(h);
+        CHECK_EQ((*linear)[i++], doctest::Approx(sorted[lo] + (h - lo) * (sorted[lo + 1] - sorted[lo])));
+    }
+
+    const auto exact = kissra::all(samples).quantiles<quantile_method::exact>({ 0.0, 0.5, 0.99, 1.0 });
+    REQUIRE(exact);
+    CHECK_EQ((*exact)[0], sorted.front());
+    CHECK_EQ((*exact)[1], sorted[49'999]);
+    CHECK_EQ((*exact)[2], sorted[98'999]);
+    CHECK_EQ((*exact)[3], sorted.back());
+
+    const std::vector qs = { 0.25, 0.75 };
+    const auto dynamic = kissra::all(samples).quantiles<quantile_method::exact>(std::span<const double>{ qs });
+    REQUIRE(dynamic);
+    CHECK_EQ(*dynamic, (std::vector{ sorted[24'999], sorted[74'999] }));
+}
+
+TEST_CASE("quantile<exact>(q) should work for any totally ordered items") {
+    std::list words = { "pear"s, "apple"s, "fig"s, "kiwi"s, "banana"s };
+    CHECK_EQ(kissra::all(words).median<quantile_method::exact>(), "fig"s);
+    CHECK_EQ(kissra::all(words).quantile<quantile_method::exact>(1.0), "pear"s);
+}
+
+TEST_CASE("nth_element(k) should return the item of rank k") {
+    std::array items = { 9, 4, 7, 1, 8, 2 };
+    CHECK_EQ(kissra::all(items).nth_element(0), 1);
+    CHECK_EQ(kissra::all(items).nth_element(3), 7);
+    CHECK_EQ(kissra::all(items).nth_element(0, std::ranges::greater{}), 9);
+    CHECK_FALSE(kissra::all(items).nth_element(6));
+    CHECK_EQ(items, (std::array{ 9, 4, 7, 1, 8, 2 }));
+}
+} // namespace kissra::test
@@ -0,0 +1,117 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <string>
+#include <string_view>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+namespace {
+/* Pipe prefilled with `content` (small enough to fit into the pipe buffer). */
+struct test_pipe {
+    explicit test_pipe(std::string_view content) {
+        REQUIRE_EQ(::pipe(fds), 0);
+        REQUIRE_EQ(::write(fds[1], content.data(), content.size()), ssize_t(content.size()));
+    }
+
+    ~test_pipe() {
+        ::close(fds[0]);
+        if (fds[1] != -1) {
+            ::close(fds[1]);
+        }
+    }
+
+    int read_end() const {
+        return fds[0];
+    }
+
+    void close_write_end() {
+        ::close(std::exchange(fds[1], -1));
+    }
+
+    std::string drain() {
+        std::string result(64, '\0');
+        const auto n = ::read(fds[0], result.data(), result.size());
+        result.resize(n > 0 ? std::size_t(n) : 0);
+        return result;
+    }
+
+    int fds[2];
+};
+
+constexpr auto to_string = [](std::string_view sv) { return std::string{ sv }; };
+} // namespace
+
+TEST_CASE("read_records(fd) should follow std::getline semantics") {
+    test_pipe p{ "a\n\nbc\nd" };
+    p.close_write_end();
+
+    CHECK_EQ(kissra::read_records(p.read_end()).transform(to_string).collect(), (std::vector{ "a"s, ""s, "bc"s, "d"s }));
+}
+
+TEST_CASE("read_records(fd) should not yield an empty record after a trailing delimiter") {
+    test_pipe p{ "a;b;" };
+    p.close_write_end();
+
+    CHECK_EQ(kissra::read_records(p.read_end(), ';').transform(to_string).collect(), (std::vector{ "a"s, "b"s }));
+}
+
+TEST_CASE("read_records(fd) should keep records straddling buffer boundaries intact") {
+    test_pipe p{ "hello\nbeautiful\nworld\n!" };
+    p.close_write_end();
+
+    CHECK_EQ(kissra::read_records(p.read_end(), '\n', 4).transform(to_string).collect(),
+        (std::vector{ "hello"s, "beautiful"s, "world"s, "!"s }));
+}
+
+TEST_CASE("read_records(fd).take(n) should stop reading as soon as it is done") {
+    test_pipe p{ "a\nb\nc\nd\ne\n" };
+
+    CHECK_EQ(kissra::read_records(p.read_end(), '\n', 4).take(2).transform(to_string).collect(), (std::vector{ "a"s, "b"s }));
+    p.close_write_end();
+    CHECK_EQ(p.drain(), "c\nd\ne\n"s);
+}
+
+TEST_CASE("read_records(fd).filter() should work") {
+    test_pipe p{ "1\n22\n333\n4444\n" };
+    p.close_write_end();
+
+    CHECK_EQ(kissra::read_records(p.read_end(), '\n', 3)
+                 .filter([](std::string_view record) { return record.size() % 2 == 0; })
+                 .transform(to_string)
+                 .collect(),
+        (std::vector{ "22"s, "4444"s }));
+}
+
+TEST_CASE("read_records(fd) of an empty stream should yield nothing") {
+    test_pipe p{ "" };
+    p.close_write_end();
+
+    CHECK_EQ(kissra::read_records(p.read_end()).transform(to_string).collect(), (std::vector<std::string>{}));
+}
+
+TEST_CASE("read_chunks(fd, block) should yield blocks of the given size") {
+    test_pipe p{ "abcdefgh" };
+    p.close_write_end();
+
+    CHECK_EQ(kissra::read_chunks(p.read_end(), 3).transform(to_string).collect(), (std::vector{ "abc"s, "def"s, "gh"s }));
+}
+
+TEST_CASE("read_chunks(fd, block) should keep the previous block valid while the next one is read") {
+    test_pipe p{ "abcdef" };
+    p.close_write_end();
+
+    auto chunks = kissra::read_chunks(p.read_end(), 2);
+    auto first = chunks.next();
+    auto second = chunks.next();
+    REQUIRE(first);
+    REQUIRE(second);
+    CHECK_EQ(*first, "ab"sv);
+    CHECK_EQ(*second, "cd"sv);
+}
+} // namespace kissra::test
\ No newline at end of file
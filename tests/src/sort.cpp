@@ -0,0 +1,92 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+namespace {
+template <typename T>
+std::vector<T> pseudo_random(std::size_t size) {
+    std::vector<T> result(size);
+    std::uint64_t state = 0x9e3779b97f4a7c15;
+    for (auto& item : result) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        item = static_cast<T>(static_cast<std::int64_t>(state) % 1'000'000);
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("sorted() should return all the items in ascending order") {
+    std::list lst = { "b"s, "c"s, "a"s };
+    CHECK_EQ(kissra::all(lst).sorted(), std::vector{ "a"s, "b"s, "c"s });
+    CHECK_EQ(kissra::all(lst).sorted(std::ranges::greater{}), std::vector{ "c"s, "b"s, "a"s });
+    CHECK_EQ(kissra::all(lst).sorted<std::list>(), std::list{ "a"s, "b"s, "c"s });
+}
+
+TEST_CASE("sorted() over many integers and floats should match std::sort") {
+    auto ints = pseudo_random<std::int64_t>(10'000);
+    auto expected_ints = ints;
+    std::ranges::sort(expected_ints);
+    CHECK_EQ(kissra::all(ints).sorted(), expected_ints);
+    std::ranges::reverse(expected_ints);
+    CHECK_EQ(kissra::all(ints).sorted(std::greater<>{}), expected_ints);
+
+    auto floats = pseudo_random<float>(10'000);
+    for (auto& item : floats) {
+        item /= 7.0f;
+    }
+    auto expected_floats = floats;
+    std::ranges::sort(expected_floats);
+    CHECK_EQ(kissra::all(floats).sorted(), expected_floats);
+
+    auto bytes = pseudo_random<std::uint8_t>(1'000);
+    auto expected_bytes = bytes;
+    std::ranges::sort(expected_bytes);
+    CHECK_EQ(kissra::all(bytes).transform([](std::uint8_t x) { return x; }).sorted(), expected_bytes);
+}
+
+TEST_CASE("sorted_by(projs...) should stably sort by the keys lexicographically") {
+    std::vector<std::tuple<int, double, std::string>> vec;
+    const auto keys = pseudo_random<int>(5'000);
+    for (std::size_t i = 0; i != keys.size(); ++i) {
+        vec.emplace_back(keys[i] % 10, double(keys[i] % 7) / 2, std::to_string(i));
+    }
+
+    auto expected = vec;
+    std::ranges::stable_sort(expected, [](const auto& l, const auto& r) {
+        return std::tie(std::get<1>(l), std::get<0>(l)) < std::tie(std::get<1>(r), std::get<0>(r));
+    });
+    CHECK_EQ(kissra::all(vec).sorted_by(kissra::fn::member<1>, kissra::fn::member<0>), expected);
+
+    std::ranges::stable_sort(expected, {}, [](const auto& item) { return std::get<2>(item).size(); });
+    CHECK_EQ(kissra::all(vec).sorted_by([](const auto& item) { return std::get<2>(item).size(); }).front(), expected.front());
+    CHECK_EQ(kissra::all(vec).sorted_by(kissra::fn::member<2>).front(), std::ranges::min(vec, {}, kissra::fn::member<2>));
+}
+
+TEST_CASE("sort_into(out) should replace the contents of out reusing its capacity") {
+    auto ints = pseudo_random<int>(1'000);
+    auto expected = ints;
+    std::ranges::sort(expected);
+
+    std::vector<int> out = { 1, 2, 3 };
+    kissra::all(ints).sort_into(out);
+    CHECK_EQ(out, expected);
+
+    const auto* data = out.data();
+    kissra::all(ints).take(10).sort_into(out, [](int x) { return -x; });
+    CHECK_EQ(out.data(), data);
+    CHECK_EQ(out.size(), 10);
+    CHECK(std::ranges::is_sorted(out, std::ranges::greater{}));
+}
+} // namespace kissra::test
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <algorithm>
+#include <forward_list>
+#include <iostream>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+TEST_CASE("split(char) should yield string_view tokens pointing into the source") {
+    std::string text = "a,bb,,ccc";
+    auto actual = kissra::split(text, ',').collect();
+
+    REQUIRE_EQ(actual, (std::vector{ "a"sv, "bb"sv, ""sv, "ccc"sv }));
+    CHECK_EQ(actual[1].data(), text.data() + 2);
+}
+
+TEST_CASE("split(char) should follow std::views::split semantics for empty input and trailing delimiter") {
+    CHECK_EQ(kissra::split(""sv, ',').collect(), (std::vector<std::string_view>{}));
+    CHECK_EQ(kissra::split(","sv, ',').collect(), (std::vector{ ""sv, ""sv }));
+    CHECK_EQ(kissra::split("a,"sv, ',').collect(), (std::vector{ "a"sv, ""sv }));
+    CHECK_EQ(kissra::split("a"sv, ',').collect(), (std::vector{ "a"sv }));
+}
+
+TEST_CASE("split(char).reverse() should tokenize backward") {
+    auto text = "a,bb,,ccc,"sv;
+
+    CHECK_EQ(kissra::split(text, ',').reverse().collect(), (std::vector{ ""sv, "ccc"sv, ""sv, "bb"sv, "a"sv }));
+}
+
+TEST_CASE("split(char) backward search should work across 8-byte words") {
+    auto text = "0123456789abcdefghij|0123456789abcdefghij|0123456789abcdefghij"sv;
+
+    CHECK_EQ(kissra::split(text, '|').back(), "0123456789abcdefghij"sv);
+    CHECK_EQ(kissra::split(text, '|').reverse().collect().size(), 3);
+}
+
+TEST_CASE("split(char) next() and next_back() should meet in the middle") {
+    auto iter = kissra::split("a,b,c"sv, ',');
+
+    CHECK_EQ(*iter.next(), "a"sv);
+    CHECK_EQ(*iter.next_back(), "c"sv);
+    CHECK_EQ(*iter.next(), "b"sv);
+    CHECK_FALSE(iter.next_back());
+    CHECK_FALSE(iter.next());
+}
+
+TEST_CASE("split(string_view) should split by multi-character delimiter") {
+    auto text = "a::bb::::ccc"sv;
+
+    CHECK_EQ(kissra::split(text, "::").collect(), (std::vector{ "a"sv, "bb"sv, ""sv, "ccc"sv }));
+    CHECK_EQ(kissra::split(text, "::").reverse().collect(), (std::vector{ "ccc"sv, ""sv, "bb"sv, "a"sv }));
+}
+
+TEST_CASE("split(\"\") should yield single characters") {
+    CHECK_EQ(kissra::split("abc"sv, ""sv).collect(), (std::vector{ "a"sv, "b"sv, "c"sv }));
+    CHECK_EQ(kissra::split("abc"sv, ""sv).reverse().collect(), (std::vector{ "c"sv, "b"sv, "a"sv }));
+}
+
+TEST_CASE("all(str).drop(N).split(char) should split only the remaining characters") {
+    std::string text = "x,a,b";
+
+    CHECK_EQ(kissra::all(text).drop(2).split(',').collect(), (std::vector{ "a"sv, "b"sv }));
+}
+
+TEST_CASE("split(char).filter().transform() should work") {
+    auto actual = kissra::split("1,22,,333"sv, ',') //
+                      .filter([](std::string_view s) { return !s.empty(); })
+                      .transform(fn::size)
+                      .collect();
+
+    CHECK_EQ(actual, (std::vector<std::size_t>{ 1, 2, 3 }));
+}
+
+TEST_CASE("split(char).chunk(N) should not leak delimiters into chunks") {
+    auto chunks = kissra::split("a,b,c,d,e"sv, ',').chunk(2);
+
+    CHECK_EQ(chunks.next()->collect(), (std::vector{ "a"sv, "b"sv }));
+    CHECK_EQ(chunks.next()->collect(), (std::vector{ "c"sv, "d"sv }));
+    CHECK_EQ(chunks.next()->collect(), (std::vector{ "e"sv }));
+    CHECK_FALSE(chunks.next());
+}
+
+TEST_CASE("apply [kissra::compo::split(char)] should work") {
+    std::string text = "a,b";
+
+    CHECK_EQ(kissra::apply(text, kissra::compo::split(',')).collect(), (std::vector{ "a"sv, "b"sv }));
+}
+} // namespace kissra::test
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <array>
+#include <list>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace kissra::test {
+namespace {
+/* Recursive halving the way a work-stealing scheduler does it. */
+template <typename TIter>
+int sum_by_halves(TIter iter, int depth, int& leaves) {
+    if (depth != 0) {
+        if (auto halves = iter.try_split()) {
+            return sum_by_halves(std::move(halves->first), depth - 1, leaves) +
+                sum_by_halves(std::move(halves->second), depth - 1, leaves);
+        }
+    }
+    ++leaves;
+    return iter.sum();
+}
+} // namespace
+
+TEST_CASE("split_at(n) should yield the first n items and the rest") {
+    std::vector items = { 1, 2, 3, 4, 5, 6, 7 };
+    auto [lhs, rhs] = kissra::all(items).transform([](int i) { return i * 10; }).split_at(3);
+
+    CHECK_EQ(lhs.collect(), (std::vector{ 10, 20, 30 }));
+    CHECK_EQ(rhs.collect(), (std::vector{ 40, 50, 60, 70 }));
+}
+
+TEST_CASE("split_at(n) should keep adaptors state in both parts") {
+    std::vector items = { 1, 3, 2, 5, 4, 7, 6, 9, 8 };
+
+    auto [taken_lhs, taken_rhs] = kissra::all(items).filter(fn::even).take(3).split_at(2);
+    CHECK_EQ(taken_lhs.collect(), (std::vector{ 2, 4 }));
+    CHECK_EQ(taken_rhs.collect(), (std::vector{ 6 }));
+
+    auto [dropped_lhs, dropped_rhs] = kissra::all(items).drop_while(fn::odd).split_at(2);
+    CHECK_EQ(dropped_lhs.collect(), (std::vector{ 2, 5 }));
+    CHECK_EQ(dropped_rhs.collect(), (std::vector{ 4, 7, 6, 9, 8 }));
+
+    std::array repeated = { 1, 2, 1, 3, 2, 4 };
+    auto [distinct_lhs, distinct_rhs] = kissra::all(repeated).distinct().split_at(2);
+    CHECK_EQ(distinct_lhs.collect(), (std::vector{ 1, 2 }));
+    CHECK_EQ(distinct_rhs.collect(), (std::vector{ 3, 4 }));
+}
+
+TEST_CASE("split_at(n) should cut chunk(k), reverse() and zip(...) at item boundaries") {
+    std::vector items = { 1, 2, 3, 4, 5, 6, 7 };
+
+    auto [chunks_lhs, chunks_rhs] = kissra::all(items).chunk(3).split_at(1);
+    CHECK_EQ(chunks_lhs.count(), 1);
+    CHECK_EQ(chunks_rhs.next()->collect(), (std::vector{ 4, 5, 6 }));
+    CHECK_EQ(chunks_rhs.next()->collect(), (std::vector{ 7 }));
+
+    auto [reversed_lhs, reversed_rhs] = kissra::all(items).reverse().split_at(2);
+    CHECK_EQ(reversed_lhs.collect(), (std::vector{ 7, 6 }));
+    CHECK_EQ(reversed_rhs.collect(), (std::vector{ 5, 4, 3, 2, 1 }));
+
+    std::list names = { 'a', 'b', 'c' };
+    auto [zipped_lhs, zipped_rhs] = kissra::all(items).zip(names).split_at(1);
+    CHECK_EQ(zipped_lhs.count(), 1);
+    CHECK_EQ(std::get<1>(*zipped_rhs.next()), 'b');
+}
+
+TEST_CASE("try_split() over filter(...) should cut the underlying positions without evaluating items") {
+    std::vector<int> items;
+    for (int i = 0; i != 1'000; ++i) {
+        items.push_back(i);
+    }
+
+    int calls = 0;
+    auto iter = kissra::all(items).filter([&](int i) {
+        ++calls;
+        return i % 3 == 0;
+    });
+    auto halves = iter.try_split();
+    REQUIRE(halves);
+    CHECK_EQ(calls, 0);
+    CHECK_EQ(halves->first.collect().back(), 498);
+    CHECK_EQ(*halves->second.next(), 501);
+
+    std::array<int, 1> single = { 1 };
+    CHECK_FALSE(kissra::all(single).filter(fn::odd).try_split());
+}
+
+TEST_CASE("try_split() over reversed zip(...) of unequal lengths should pair items as the sequential iteration does") {
+    std::vector<int> lhs;
+    for (int i = 0; i != 10; ++i) {
+        lhs.push_back(i);
+    }
+    std::vector rhs = { 0, 1, 2, 3, 4, 5 };
+
+    auto zipped = kissra::all(lhs).zip(rhs).filter([](int l, int) { return l != 3; });
+    auto reversed = zipped.reverse().transform([](int l, int r) { return l * 10 + r; });
+    auto sequential = reversed;
+    REQUIRE_EQ(sequential.collect(), (std::vector{ 55, 44, 22, 11, 0 }));
+
+    auto reversed_halves = reversed.try_split();
+    REQUIRE(reversed_halves);
+    CHECK_EQ(reversed_halves->first.collect(), (std::vector{ 55, 44 }));
+    CHECK_EQ(reversed_halves->second.collect(), (std::vector{ 22, 11, 0 }));
+
+    auto twice_reversed_halves = zipped.reverse().reverse().transform([](int l, int r) { return l * 10 + r; }).try_split();
+    REQUIRE(twice_reversed_halves);
+    CHECK_EQ(twice_reversed_halves->first.collect(), (std::vector{ 0, 11, 22 }));
+    CHECK_EQ(twice_reversed_halves->second.collect(), (std::vector{ 44, 55 }));
+}
+
+TEST_CASE("recursive try_split() should cover every item exactly once") {
+    std::vector<int> items;
+    for (int i = 0; i != 10'000; ++i) {
+        items.push_back(i);
+    }
+
+    int leaves = 0;
+    CHECK_EQ(sum_by_halves(kissra::all(items).filter(fn::odd).reverse(), 6, leaves), 25'000'000);
+    CHECK_EQ(leaves, 64);
+
+    leaves = 0;
+    CHECK_EQ(sum_by_halves(kissra::all(items).drop(10).take(100), 6, leaves), 5'950);
+    CHECK_EQ(leaves, 64);
+}
+
+TEST_CASE("splittable_iterator should hold for adaptors which can be cut into independent parts") {
+    std::vector<int> items;
+    std::list<int> list;
+    static_assert(kissra::splittable_iterator<decltype(kissra::all(items).filter(fn::odd).drop_while(fn::odd))>);
+    static_assert(kissra::splittable_iterator<decltype(kissra::all(items).chunk(64).reverse())>);
+    static_assert(!kissra::splittable_iterator<decltype(kissra::all(list).filter(fn::odd))>);
+    static_assert(!kissra::splittable_iterator<decltype(kissra::all(items).filter(fn::odd).chunk(64))>);
+}
+} // namespace kissra::test
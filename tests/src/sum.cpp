@@ -0,0 +1,123 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+TEST_CASE("sum() should add up all the items") {
+    std::array arr = { 1, 2, 3, 4, 5 };
+    CHECK_EQ(kissra::all(arr).sum(), 15);
+}
+
+TEST_CASE("sum() / product() of nothing should be an identity element") {
+    std::vector<int> vec;
+    CHECK_EQ(kissra::all(vec).sum(), 0);
+    CHECK_EQ(kissra::all(vec).product(), 1);
+}
+
+TEST_CASE("sum() of many contiguous items should match std::accumulate") {
+    std::vector<std::int64_t> vec(10'001);
+    std::iota(vec.begin(), vec.end(), -5'000);
+    vec.back() = 7;
+
+    CHECK_EQ(kissra::all(vec).sum(), std::accumulate(vec.begin(), vec.end(), std::int64_t{}));
+    CHECK_EQ(kissra::all(vec).drop(3).sum(), std::accumulate(vec.begin() + 3, vec.end(), std::int64_t{}));
+}
+
+TEST_CASE("sum<TAcc>() should accumulate into a wider type") {
+    std::vector<std::uint8_t> vec(1'000, 200);
+    CHECK_EQ(kissra::all(vec).sum(), 200'000);
+    CHECK_EQ(kissra::all(vec).sum<std::uint64_t>(), 200'000u);
+    CHECK_EQ(kissra::all(vec).sum<std::uint8_t>(), std::uint8_t(200'000 % 256));
+}
+
+TEST_CASE("transform().sum() / filter().sum() should be fused into the contiguous kernel") {
+    std::vector<int> vec(1'000);
+    std::iota(vec.begin(), vec.end(), 1);
+
+    CHECK_EQ(kissra::all(vec).transform([](int x) { return x * 2; }).sum(), 1'001'000);
+    CHECK_EQ(kissra::all(vec).filter(kissra::fn::even).sum(), 250'500);
+    CHECK_EQ(kissra::all(vec).transform([](int x) { return x + 1; }).filter(kissra::fn::odd).filter(kissra::fn::gt(500)).sum(),
+        188'501);
+}
+
+TEST_CASE("members<I>().sum() should work for contiguous aggregates") {
+    struct row {
+        std::string name;
+        double score;
+    };
+    std::vector<row> rows = { { "a", 0.5 }, { "b", 1.5 }, { "c", 2.0 } };
+    CHECK_EQ(kissra::all(rows).members<1>().sum(), 4.0);
+}
+
+TEST_CASE("take().sum() should work for non-contiguous iterators") {
+    std::array arr = { 1, 2, 3, 4, 5 };
+    CHECK_EQ(kissra::all(arr).take(3).sum(), 6);
+    CHECK_EQ(kissra::all(arr).take(3).sum<kissra::summation::strict>(), 6);
+}
+
+TEST_CASE("sum() should work for non-arithmetic items") {
+    std::array arr = { "a"s, "b"s, "c"s };
+    CHECK_EQ(kissra::all(arr).sum(), "abc"s);
+}
+
+TEST_CASE("pairwise / kahan summation should be more accurate than the strict one") {
+    std::vector<float> vec(1'000'000, 0.1f);
+    const double exact = 100'000.0;
+
+    const auto strict = kissra::all(vec).sum<kissra::summation::strict>();
+    const auto pairwise = kissra::all(vec).sum<kissra::summation::pairwise>();
+    const auto kahan = kissra::all(vec).sum<kissra::summation::kahan>();
+
+    /* Every other item is filtered out: the filtered kernel has to keep the compensation across the skipped ones. */
+    std::vector<float> interleaved(2'000'000, -1.0f);
+    for (std::size_t i = 0; i < interleaved.size(); i += 2) {
+        interleaved[i] = 0.1f;
+    }
+    const auto filtered_kahan = kissra::all(interleaved).filter(kissra::fn::gt(0.0f)).sum<kissra::summation::kahan>();
+
+    CHECK_GT(std::abs(strict - exact), 100.0);
+    CHECK_LT(std::abs(pairwise - exact), 1.0);
+    CHECK_LT(std::abs(kahan - exact), 0.05);
+    CHECK_LT(std::abs(filtered_kahan - exact), 0.05);
+}
+
+TEST_CASE("sum<summation::strict>() should add up items strictly left to right") {
+    std::array arr = { 1e20, 1.0, -1e20, 1.0 };
+    CHECK_EQ(kissra::all(arr).sum<kissra::summation::strict>(), std::accumulate(arr.begin(), arr.end(), 0.0));
+    CHECK_EQ(kissra::all(arr).sum<kissra::summation::kahan>(), 2.0);
+}
+
+TEST_CASE("product() should multiply all the items") {
+    std::array arr = { 1, 2, 3, 4, 5 };
+    CHECK_EQ(kissra::all(arr).product(), 120);
+    CHECK_EQ(kissra::all(arr).filter(kissra::fn::odd).product(), 15);
+    CHECK_EQ(kissra::all(arr).take(4).product<std::int64_t>(), 24);
+}
+
+TEST_CASE("sum() / product() of signed integers should be right whenever the result fits") {
+    std::vector<int> vec(9, 0);
+    vec[0] = INT_MAX;
+    vec[1] = -1;
+    vec[8] = 1;
+    CHECK_EQ(kissra::all(vec).sum(), INT_MAX);
+    std::list<int> lst(vec.begin(), vec.end());
+    CHECK_EQ(kissra::all(lst).sum(), INT_MAX);
+
+    std::vector<int> factors(9, 1);
+    factors[0] = 1 << 16;
+    factors[8] = 1 << 16;
+    factors[1] = 0;
+    CHECK_EQ(kissra::all(factors).product(), 0);
+}
+} // namespace kissra::test
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "kissra/doctest_printers.hpp"
+
+#include "kissra/kissra.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace kissra::test {
+using namespace std::string_literals;
+
+namespace {
+std::vector<std::int64_t> pseudo_random(std::size_t n) {
+    std::vector<std::int64_t> result(n);
+    std::uint64_t state = 42;
+    for (auto& x : result) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        x = std::int64_t(state >> 40) - (1 << 23);
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("top_k(k) should return k greatest items in descending order") {
+    std::array arr = { 5, 1, 9, 3, 7, 2, 8 };
+    CHECK_EQ(kissra::all(arr).top_k(3), (std::vector{ 9, 8, 7 }));
+}
+
+TEST_CASE("bottom_k(k) should return k least items in ascending order") {
+    std::array arr = { 5, 1, 9, 3, 7, 2, 8 };
+    CHECK_EQ(kissra::all(arr).bottom_k(3), (std::vector{ 1, 2, 3 }));
+}
+
+TEST_CASE("top_k(k) should return everything sorted if k exceeds the number of items") {
+    std::array arr = { 2, 3, 1 };
+    CHECK_EQ(kissra::all(arr).top_k(10), (std::vector{ 3, 2, 1 }));
+    CHECK_EQ(kissra::all(arr).top_k(0), (std::vector<int>{}));
+}
+
+TEST_CASE("top_k(k) / bottom_k(k) over contiguous arithmetic items should match partial_sort") {
+    const auto vec = pseudo_random(10'000);
+
+    auto expected_top = vec;
+    std::ranges::partial_sort(expected_top, expected_top.begin() + 100, std::ranges::greater{});
+    expected_top.resize(100);
+    CHECK_EQ(kissra::all(vec).top_k(100), expected_top);
+
+    auto expected_bottom = vec;
+    std::ranges::partial_sort(expected_bottom, expected_bottom.begin() + 100);
+    expected_bottom.resize(100);
+    CHECK_EQ(kissra::all(vec).bottom_k(100), expected_bottom);
+    CHECK_EQ(kissra::all(vec).top_k(100, std::ranges::greater{}), expected_bottom);
+}
+
+TEST_CASE("drop(n).top_k(k) should only consider remaining items") {
+    std::vector<int> vec(1000);
+    for (int i = 0; i != 1000; ++i) {
+        vec[i] = 1000 - i;
+    }
+    CHECK_EQ(kissra::all(vec).drop(10).top_k(2), (std::vector{ 990, 989 }));
+}
+
+TEST_CASE("top_k(k, cmp, proj) should compare projected items") {
+    std::array arr = { "ccc"s, "a"s, "dddd"s, "bb"s };
+    CHECK_EQ(kissra::all(arr).top_k(2, std::ranges::less{}, kissra::fn::size), (std::vector{ "dddd"s, "ccc"s }));
+    CHECK_EQ(kissra::all(arr).bottom_k(2, std::ranges::less{}, kissra::fn::size), (std::vector{ "a"s, "bb"s }));
+}
+
+TEST_CASE("filter().top_k(k) should work for unsized iterators") {
+    const auto vec = pseudo_random(1'000);
+
+    std::vector<std::int64_t> expected;
+    std::ranges::copy_if(vec, std::back_inserter(expected), kissra::fn::even);
+    std::ranges::sort(expected, std::ranges::greater{});
+    expected.resize(10);
+
+    CHECK_EQ(kissra::all(vec).filter(kissra::fn::even).top_k(10), expected);
+}
+} // namespace kissra::test
\ No newline at end of file